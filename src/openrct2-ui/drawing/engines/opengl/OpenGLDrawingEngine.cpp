@@ -99,14 +99,16 @@ public:
     void ResetPalette();
     void StartNewDraw();
 
-    void Clear(uint8_t paletteIndex) override;
-    void FillRect(uint32_t colour, int32_t x, int32_t y, int32_t w, int32_t h) override;
-    void FilterRect(FILTER_PALETTE_ID palette, int32_t left, int32_t top, int32_t right, int32_t bottom) override;
-    void DrawLine(uint32_t colour, int32_t x1, int32_t y1, int32_t x2, int32_t y2) override;
-    void DrawSprite(uint32_t image, int32_t x, int32_t y, uint32_t tertiaryColour) override;
-    void DrawSpriteRawMasked(int32_t x, int32_t y, uint32_t maskImage, uint32_t colourImage) override;
-    void DrawSpriteSolid(uint32_t image, int32_t x, int32_t y, uint8_t colour) override;
-    void DrawGlyph(uint32_t image, int32_t x, int32_t y, uint8_t* palette) override;
+    // Commands are recorded from one thread into one buffer, these use the clip set by SetDPI rather than the dpi argument
+    void Clear(rct_drawpixelinfo* dpi, uint8_t paletteIndex) override;
+    void FillRect(rct_drawpixelinfo* dpi, uint32_t colour, int32_t x, int32_t y, int32_t w, int32_t h) override;
+    void FilterRect(
+        rct_drawpixelinfo* dpi, FILTER_PALETTE_ID palette, int32_t left, int32_t top, int32_t right, int32_t bottom) override;
+    void DrawLine(rct_drawpixelinfo* dpi, uint32_t colour, int32_t x1, int32_t y1, int32_t x2, int32_t y2) override;
+    void DrawSprite(rct_drawpixelinfo* dpi, uint32_t image, int32_t x, int32_t y, uint32_t tertiaryColour) override;
+    void DrawSpriteRawMasked(rct_drawpixelinfo* dpi, int32_t x, int32_t y, uint32_t maskImage, uint32_t colourImage) override;
+    void DrawSpriteSolid(rct_drawpixelinfo* dpi, uint32_t image, int32_t x, int32_t y, uint8_t colour) override;
+    void DrawGlyph(rct_drawpixelinfo* dpi, uint32_t image, int32_t x, int32_t y, uint8_t* palette) override;
 
     void FlushCommandBuffers();
 
@@ -480,12 +482,13 @@ void OpenGLDrawingContext::StartNewDraw()
     _swapFramebuffer->Clear();
 }
 
-void OpenGLDrawingContext::Clear(uint8_t paletteIndex)
+void OpenGLDrawingContext::Clear(rct_drawpixelinfo* dpi, uint8_t paletteIndex)
 {
-    FillRect(paletteIndex, _clipLeft - _offsetX, _clipTop - _offsetY, _clipRight - _offsetX, _clipBottom - _offsetY);
+    FillRect(dpi, paletteIndex, _clipLeft - _offsetX, _clipTop - _offsetY, _clipRight - _offsetX, _clipBottom - _offsetY);
 }
 
-void OpenGLDrawingContext::FillRect(uint32_t colour, int32_t left, int32_t top, int32_t right, int32_t bottom)
+void OpenGLDrawingContext::FillRect(
+    [[maybe_unused]] rct_drawpixelinfo* dpi, uint32_t colour, int32_t left, int32_t top, int32_t right, int32_t bottom)
 {
     left += _offsetX;
     top += _offsetY;
@@ -517,7 +520,9 @@ void OpenGLDrawingContext::FillRect(uint32_t colour, int32_t left, int32_t top,
     }
 }
 
-void OpenGLDrawingContext::FilterRect(FILTER_PALETTE_ID palette, int32_t left, int32_t top, int32_t right, int32_t bottom)
+void OpenGLDrawingContext::FilterRect(
+    [[maybe_unused]] rct_drawpixelinfo* dpi, FILTER_PALETTE_ID palette, int32_t left, int32_t top, int32_t right,
+    int32_t bottom)
 {
     left += _offsetX;
     top += _offsetY;
@@ -538,7 +543,8 @@ void OpenGLDrawingContext::FilterRect(FILTER_PALETTE_ID palette, int32_t left, i
     command.depth = _drawCount++;
 }
 
-void OpenGLDrawingContext::DrawLine(uint32_t colour, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+void OpenGLDrawingContext::DrawLine(
+    [[maybe_unused]] rct_drawpixelinfo* dpi, uint32_t colour, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
 {
     x1 += _offsetX;
     y1 += _offsetY;
@@ -553,7 +559,8 @@ void OpenGLDrawingContext::DrawLine(uint32_t colour, int32_t x1, int32_t y1, int
     command.depth = _drawCount++;
 }
 
-void OpenGLDrawingContext::DrawSprite(uint32_t image, int32_t x, int32_t y, uint32_t tertiaryColour)
+void OpenGLDrawingContext::DrawSprite(
+    [[maybe_unused]] rct_drawpixelinfo* dpi, uint32_t image, int32_t x, int32_t y, uint32_t tertiaryColour)
 {
     int32_t g1Id = image & 0x7FFFF;
     auto g1Element = gfx_get_g1_element(g1Id);
@@ -575,7 +582,7 @@ void OpenGLDrawingContext::DrawSprite(uint32_t image, int32_t x, int32_t y, uint
             zoomedDPI.pitch = _dpi->pitch;
             zoomedDPI.zoom_level = _dpi->zoom_level - 1;
             SetDPI(&zoomedDPI);
-            DrawSprite((image & 0xFFF80000) | (g1Id - g1Element->zoomed_offset), x >> 1, y >> 1, tertiaryColour);
+            DrawSprite(&zoomedDPI, (image & 0xFFF80000) | (g1Id - g1Element->zoomed_offset), x >> 1, y >> 1, tertiaryColour);
             return;
         }
         if (g1Element->flags & (1 << 5))
@@ -701,7 +708,8 @@ void OpenGLDrawingContext::DrawSprite(uint32_t image, int32_t x, int32_t y, uint
     }
 }
 
-void OpenGLDrawingContext::DrawSpriteRawMasked(int32_t x, int32_t y, uint32_t maskImage, uint32_t colourImage)
+void OpenGLDrawingContext::DrawSpriteRawMasked(
+    [[maybe_unused]] rct_drawpixelinfo* dpi, int32_t x, int32_t y, uint32_t maskImage, uint32_t colourImage)
 {
     auto g1ElementMask = gfx_get_g1_element(maskImage & 0x7FFFF);
     auto g1ElementColour = gfx_get_g1_element(colourImage & 0x7FFFF);
@@ -763,7 +771,8 @@ void OpenGLDrawingContext::DrawSpriteRawMasked(int32_t x, int32_t y, uint32_t ma
     command.depth = _drawCount++;
 }
 
-void OpenGLDrawingContext::DrawSpriteSolid(uint32_t image, int32_t x, int32_t y, uint8_t colour)
+void OpenGLDrawingContext::DrawSpriteSolid(
+    [[maybe_unused]] rct_drawpixelinfo* dpi, uint32_t image, int32_t x, int32_t y, uint8_t colour)
 {
     assert((colour & 0xFF) > 0u);
 
@@ -814,7 +823,8 @@ void OpenGLDrawingContext::DrawSpriteSolid(uint32_t image, int32_t x, int32_t y,
     command.depth = _drawCount++;
 }
 
-void OpenGLDrawingContext::DrawGlyph(uint32_t image, int32_t x, int32_t y, uint8_t* palette)
+void OpenGLDrawingContext::DrawGlyph(
+    [[maybe_unused]] rct_drawpixelinfo* dpi, uint32_t image, int32_t x, int32_t y, uint8_t* palette)
 {
     auto g1Element = gfx_get_g1_element(image & 0x7FFFF);
     if (g1Element == nullptr)
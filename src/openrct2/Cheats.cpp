@@ -113,6 +113,7 @@ static void cheat_fix_vandalism()
 
         it.element->flags &= ~TILE_ELEMENT_FLAG_BROKEN;
     } while (tile_element_iterator_next(&it));
+    map_invalidate_tile_indices();
 
     gfx_invalidate_screen();
 }
@@ -470,7 +471,7 @@ static void cheat_own_all_land()
             // only own tiles that were not set to 0
             if (destOwnership != OWNERSHIP_UNOWNED)
             {
-                surfaceElement->properties.surface.ownership |= destOwnership;
+                park_set_surface_ownership(surfaceElement, surfaceElement->properties.surface.ownership | destOwnership);
                 update_park_fences_around_tile(coords);
                 uint16_t baseHeight = surfaceElement->base_height * 8;
                 map_invalidate_tile(coords.x, coords.y, baseHeight, baseHeight + 16);
@@ -486,7 +487,7 @@ static void cheat_own_all_land()
         if (x != PEEP_SPAWN_UNDEFINED)
         {
             rct_tile_element* surfaceElement = map_get_surface_element_at({ x, y });
-            surfaceElement->properties.surface.ownership = OWNERSHIP_UNOWNED;
+            park_set_surface_ownership(surfaceElement, OWNERSHIP_UNOWNED);
             update_park_fences_around_tile({ x, y });
             uint16_t baseHeight = surfaceElement->base_height * 8;
             map_invalidate_tile(x, y, baseHeight, baseHeight + 16);
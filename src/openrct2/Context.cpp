@@ -36,6 +36,7 @@
 #include "core/Guard.hpp"
 #include "core/MemoryStream.h"
 #include "core/Path.hpp"
+#include "core/Profiler.hpp"
 #include "core/String.hpp"
 #include "core/Util.hpp"
 #include "drawing/IDrawingEngine.h"
@@ -135,12 +136,16 @@ namespace OpenRCT2
 
         ~Context() override
         {
+            // Make sure an autosave is not cut short
+            scenario_wait_for_background_save();
+
             window_close_all();
             object_manager_unload_all_objects();
             gfx_object_check_all_images_freed();
             gfx_unload_g2();
             gfx_unload_g1();
             config_release();
+            Profiler::StopTrace();
 
             Instance = nullptr;
         }
@@ -847,6 +852,7 @@ namespace OpenRCT2
                 _painter->Paint(*_drawingEngine);
                 _drawingEngine->EndDraw();
             }
+            Profiler::EndFrame();
         }
 
         void RunVariableFrame()
@@ -894,6 +900,7 @@ namespace OpenRCT2
 
                 sprite_position_tween_restore();
             }
+            Profiler::EndFrame();
         }
 
         void Update()
@@ -62,6 +62,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <string>
 
 #define NUMBER_OF_AUTOSAVES_TO_KEEP 9
 
@@ -469,6 +470,7 @@ int32_t game_do_command_p(
 
             // Second call to actually perform the operation
             new_game_command_table[command](eax, ebx, ecx, edx, esi, edi, ebp);
+            peep_pathfind_invalidate_cache();
 
             // Do the callback (required for multiplayer to work correctly), but only for top level commands
             if (gGameCommandNestLevel == 1)
@@ -1125,11 +1127,10 @@ void game_load_init()
     auto windowManager = GetContext()->GetUiContext()->GetWindowManager();
     windowManager->SetMainView(gSavedViewX, gSavedViewY, gSavedViewZoom, gSavedViewRotation);
 
-    if (network_get_mode() != NETWORK_MODE_CLIENT)
-    {
-        reset_sprite_spatial_index();
-    }
+    reset_sprite_spatial_index();
     reset_all_sprite_quadrant_placements();
+    map_invalidate_tile_indices();
+    staff_invalidate_type_lists();
     scenery_set_default_placement_configuration();
 
     auto intent = Intent(INTENT_ACTION_REFRESH_NEW_RIDES);
@@ -1316,7 +1317,7 @@ void game_autosave()
         timeName, sizeof(timeName), "autosave_%04u-%02u-%02u_%02u-%02u-%02u%s", currentDate.year, currentDate.month,
         currentDate.day, currentTime.hour, currentTime.minute, currentTime.second, fileExtension);
 
-    limit_autosave_count(NUMBER_OF_AUTOSAVES_TO_KEEP, (gScreenFlags & SCREEN_FLAGS_EDITOR));
+    bool isEditor = (gScreenFlags & SCREEN_FLAGS_EDITOR) != 0;
 
     utf8 path[MAX_PATH];
     utf8 backupPath[MAX_PATH];
@@ -1329,12 +1330,16 @@ void game_autosave()
     safe_strcat(backupPath, fileExtension, sizeof(backupPath));
     safe_strcat(backupPath, ".bak", sizeof(backupPath));
 
-    if (platform_file_exists(path))
-    {
-        platform_file_copy(path, backupPath, true);
-    }
-
-    scenario_save(path, saveFlags);
+    // Tidying up old autosaves is left to the background thread along with writing the new one
+    std::string pathCopy = path;
+    std::string backupPathCopy = backupPath;
+    scenario_save_in_background(path, saveFlags, [isEditor, pathCopy, backupPathCopy]() {
+        limit_autosave_count(NUMBER_OF_AUTOSAVES_TO_KEEP, isEditor);
+        if (platform_file_exists(pathCopy.c_str()))
+        {
+            platform_file_copy(pathCopy.c_str(), backupPathCopy.c_str(), true);
+        }
+    });
 }
 
 static void game_load_or_quit_no_save_prompt_callback(int32_t result, const utf8* path)
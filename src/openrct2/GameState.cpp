@@ -13,6 +13,7 @@
 #include "Editor.h"
 #include "Input.h"
 #include "OpenRCT2.h"
+#include "core/Profiler.hpp"
 #include "interface/Screenshot.h"
 #include "localisation/Date.h"
 #include "localisation/Localisation.h"
@@ -188,13 +189,29 @@ void GameState::Update()
     gInUpdateCode = false;
 }
 
-void GameState::UpdateLogic()
+void GameState::UpdateLogic(LogicTimings* timings)
 {
+    Profiler::ScopedTimer profilerScope("GameState::UpdateLogic");
+    auto lastTime = std::chrono::high_resolution_clock::time_point();
+    if (timings != nullptr)
+    {
+        lastTime = std::chrono::high_resolution_clock::now();
+    }
+    auto reportTime = [timings, &lastTime](LogicTimePart part) {
+        if (timings != nullptr)
+        {
+            auto now = std::chrono::high_resolution_clock::now();
+            timings->Totals[(size_t)part] += now - lastTime;
+            lastTime = now;
+        }
+    };
+
     gScreenAge++;
     if (gScreenAge == 0)
         gScreenAge--;
 
     network_update();
+    reportTime(LogicTimePart::NetworkUpdate);
 
     if (network_get_mode() == NETWORK_MODE_CLIENT && network_get_status() == NETWORK_STATUS_CONNECTED
         && network_get_authstatus() == NETWORK_AUTH_OK)
@@ -220,33 +237,51 @@ void GameState::UpdateLogic()
 
     date_update();
     _date = Date(gDateMonthTicks, gDateMonthTicks);
+    reportTime(LogicTimePart::Date);
 
     scenario_update();
+    reportTime(LogicTimePart::Scenario);
     climate_update();
+    reportTime(LogicTimePart::Climate);
     map_update_tiles();
+    reportTime(LogicTimePart::MapTiles);
     // Temporarily remove provisional paths to prevent peep from interacting with them
     map_remove_provisional_elements();
+    reportTime(LogicTimePart::MapStashProvisionalElements);
     map_update_path_wide_flags();
+    reportTime(LogicTimePart::MapPathWideFlags);
     peep_update_all();
+    reportTime(LogicTimePart::Peep);
     map_restore_provisional_elements();
+    reportTime(LogicTimePart::MapRestoreProvisionalElements);
     vehicle_update_all();
+    reportTime(LogicTimePart::Vehicle);
     sprite_misc_update_all();
+    reportTime(LogicTimePart::Misc);
     ride_update_all();
+    reportTime(LogicTimePart::Ride);
 
     if (!(gScreenFlags & (SCREEN_FLAGS_SCENARIO_EDITOR | SCREEN_FLAGS_TRACK_DESIGNER | SCREEN_FLAGS_TRACK_MANAGER)))
     {
         _park->Update(_date);
     }
+    reportTime(LogicTimePart::Park);
 
     research_update();
+    reportTime(LogicTimePart::Research);
     ride_ratings_update_all();
+    reportTime(LogicTimePart::RideRatings);
     ride_measurements_update();
+    reportTime(LogicTimePart::RideMeasurements);
     news_item_update_current();
+    reportTime(LogicTimePart::News);
 
     map_animation_invalidate_all();
+    reportTime(LogicTimePart::MapAnimation);
     vehicle_sounds_update();
     peep_update_crowd_noise();
     climate_update_sound();
+    reportTime(LogicTimePart::Sounds);
     editor_open_windows_for_current_step();
 
     // Update windows
@@ -271,14 +306,22 @@ void GameState::UpdateLogic()
     {
         gLastAutoSaveUpdate = Platform::GetTicks();
     }
+    reportTime(LogicTimePart::Windows);
 
     // Separated out processing commands in network_update which could call scenario_rand where gInUpdateCode is false.
     // All commands that are received are first queued and then executed where gInUpdateCode is set to true.
     network_process_game_commands();
+    reportTime(LogicTimePart::GameCommands);
 
     network_flush();
+    reportTime(LogicTimePart::NetworkFlush);
 
     gCurrentTicks++;
     gScenarioTicks++;
     gSavedAge++;
+
+    if (timings != nullptr)
+    {
+        timings->Ticks++;
+    }
 }
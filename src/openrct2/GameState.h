@@ -11,12 +11,53 @@
 
 #include "Date.h"
 
+#include <array>
+#include <chrono>
 #include <memory>
 
 namespace OpenRCT2
 {
     class Park;
 
+    /**
+     * The stages of a single logic update, in the order they are run.
+     */
+    enum class LogicTimePart : uint8_t
+    {
+        NetworkUpdate,
+        Date,
+        Scenario,
+        Climate,
+        MapTiles,
+        MapStashProvisionalElements,
+        MapPathWideFlags,
+        Peep,
+        MapRestoreProvisionalElements,
+        Vehicle,
+        Misc,
+        Ride,
+        Park,
+        Research,
+        RideRatings,
+        RideMeasurements,
+        News,
+        MapAnimation,
+        Sounds,
+        Windows,
+        GameCommands,
+        NetworkFlush,
+        Count
+    };
+
+    /**
+     * Accumulated wall clock time spent in each stage of the logic update.
+     */
+    struct LogicTimings
+    {
+        std::array<std::chrono::duration<double>, (size_t)LogicTimePart::Count> Totals{};
+        uint32_t Ticks{};
+    };
+
     /**
      * Class to update the state of the map and park.
      */
@@ -41,6 +82,6 @@ namespace OpenRCT2
 
         void InitAll(int32_t mapSize);
         void Update();
-        void UpdateLogic();
+        void UpdateLogic(LogicTimings* timings = nullptr);
     };
 } // namespace OpenRCT2
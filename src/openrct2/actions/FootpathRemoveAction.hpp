@@ -87,7 +87,7 @@ public:
             remove_banners_at_element(_x, _y, footpathElement);
             footpath_remove_edges_at(_x, _y, footpathElement);
             map_invalidate_tile_full(_x, _y);
-            tile_element_remove(footpathElement);
+            tile_element_remove(_x / 32, _y / 32, footpathElement);
             footpath_update_queue_chains();
         }
 
@@ -16,6 +16,7 @@
 #include "../core/Util.hpp"
 #include "../localisation/Localisation.h"
 #include "../network/network.h"
+#include "../peep/Peep.h"
 #include "../platform/platform.h"
 #include "../scenario/Scenario.h"
 #include "../world/Park.h"
@@ -180,6 +181,7 @@ namespace GameActions
 
             // Execute the action, changing the game state
             result = action->Execute();
+            peep_pathfind_invalidate_cache();
 
             gCommandPosition.x = result->Position.x;
             gCommandPosition.y = result->Position.y;
@@ -356,7 +356,7 @@ public:
         if ((tileElement->properties.track.maze_entry & 0x8888) == 0x8888)
         {
             Ride* ride = get_ride(_rideIndex);
-            tile_element_remove(tileElement);
+            tile_element_remove(_x / 32, _y / 32, tileElement);
             sub_6CB945(_rideIndex);
             ride->maze_tiles--;
         }
@@ -177,7 +177,7 @@ public:
             if (!(flags & GAME_COMMAND_FLAG_GHOST))
             {
                 rct_tile_element* surfaceElement = map_get_surface_element_at(entranceLoc);
-                surfaceElement->properties.surface.ownership = 0;
+                park_set_surface_ownership(surfaceElement, 0);
             }
 
             rct_tile_element* newElement = tile_element_insert(entranceLoc.x / 32, entranceLoc.y / 32, zLow, 0xF);
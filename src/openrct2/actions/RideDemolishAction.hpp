@@ -308,7 +308,7 @@ private:
                     type | (tile_element_get_track_sequence(it.element) << 8), GAME_COMMAND_REMOVE_TRACK, z, 0);
 
                 if (removePrice == MONEY32_UNDEFINED)
-                    tile_element_remove(it.element);
+                    tile_element_remove(it.x, it.y, it.element);
                 else
                     refundPrice += removePrice;
 
@@ -95,7 +95,7 @@ public:
         tile_element_remove_banner_entry(wallElement);
         map_invalidate_tile_zoom1(
             _location.x << 5, _location.y << 5, wallElement->base_height * 8, (wallElement->base_height * 8) + 72);
-        tile_element_remove(wallElement);
+        tile_element_remove(_location.x, _location.y, wallElement);
 
         return res;
     }
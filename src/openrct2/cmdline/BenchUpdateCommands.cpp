@@ -0,0 +1,128 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../Game.h"
+#include "../GameState.h"
+#include "../Intro.h"
+#include "../OpenRCT2.h"
+#include "../core/Console.hpp"
+#include "../core/Profiler.hpp"
+#include "../platform/platform.h"
+#include "CommandLine.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+
+using namespace OpenRCT2;
+
+static exitcode_t HandleBenchSimulate(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::BenchSimulateCommands[]{
+    // Main commands
+    DefineCommand("", "<file> <ticks> [trace]", nullptr, HandleBenchSimulate), CommandTableEnd
+};
+
+static constexpr const char* LogicTimePartNames[] = {
+    "network_update",
+    "date_update",
+    "scenario_update",
+    "climate_update",
+    "map_update_tiles",
+    "map_remove_provisional_elements",
+    "map_update_path_wide_flags",
+    "peep_update_all",
+    "map_restore_provisional_elements",
+    "vehicle_update_all",
+    "sprite_misc_update_all",
+    "ride_update_all",
+    "park_update",
+    "research_update",
+    "ride_ratings_update_all",
+    "ride_measurements_update",
+    "news_item_update_current",
+    "map_animation_invalidate_all",
+    "sounds_update",
+    "editor_windows_and_errors",
+    "network_process_game_commands",
+    "network_flush",
+};
+static_assert(std::size(LogicTimePartNames) == (size_t)LogicTimePart::Count, "Missing logic time part name");
+
+static void PrintLogicTimings(const LogicTimings& timings, std::chrono::duration<double> elapsed)
+{
+    Console::WriteLine("%-34s %12s %12s %8s", "Stage", "Total (ms)", "Tick (us)", "Share");
+    for (size_t i = 0; i < (size_t)LogicTimePart::Count; i++)
+    {
+        double totalMs = timings.Totals[i].count() * 1000.0;
+        double perTickUs = timings.Totals[i].count() * 1000000.0 / timings.Ticks;
+        double share = timings.Totals[i].count() * 100.0 / elapsed.count();
+        Console::WriteLine("%-34s %12.2f %12.2f %7.2f%%", LogicTimePartNames[i], totalMs, perTickUs, share);
+    }
+    Console::WriteLine();
+    Console::WriteLine(
+        "Simulated %u ticks in %.2f seconds (%.1f ticks/sec).", timings.Ticks, elapsed.count(),
+        timings.Ticks / elapsed.count());
+}
+
+static exitcode_t HandleBenchSimulate(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = (const char**)argEnumerator->GetArguments() + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+    if (argc != 2 && argc != 3)
+    {
+        Console::Error::WriteLine("Usage: openrct2 benchsimulate <file> <ticks> [trace]");
+        return EXITCODE_FAIL;
+    }
+
+    const char* inputPath = argv[0];
+    int32_t ticks = std::atoi(argv[1]);
+    if (ticks <= 0)
+    {
+        Console::Error::WriteLine("The number of ticks must be greater than zero.");
+        return EXITCODE_FAIL;
+    }
+
+    core_init();
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        return EXITCODE_FAIL;
+    }
+    if (!context->LoadParkFromFile(inputPath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    gIntroState = INTRO_STATE_NONE;
+    gScreenFlags = SCREEN_FLAGS_PLAYING;
+
+    // The trace is written when the context is disposed
+    if (argc == 3)
+    {
+        Profiler::StartTrace(argv[2]);
+    }
+
+    auto gameState = context->GetGameState();
+    LogicTimings timings;
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for (int32_t i = 0; i < ticks; i++)
+    {
+        gameState->UpdateLogic(&timings);
+    }
+    auto endTime = std::chrono::high_resolution_clock::now();
+
+    PrintLogicTimings(timings, endTime - startTime);
+    return EXITCODE_OK;
+}
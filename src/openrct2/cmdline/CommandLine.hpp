@@ -117,6 +117,7 @@ namespace CommandLine
     extern const CommandLineCommand ScreenshotCommands[];
     extern const CommandLineCommand SpriteCommands[];
     extern const CommandLineCommand BenchGfxCommands[];
+    extern const CommandLineCommand BenchSimulateCommands[];
 
     extern const CommandLineExample RootExamples[];
 
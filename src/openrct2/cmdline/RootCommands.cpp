@@ -16,6 +16,7 @@
 #include "../core/Guard.hpp"
 #include "../core/Memory.hpp"
 #include "../core/Path.hpp"
+#include "../core/Profiler.hpp"
 #include "../core/String.hpp"
 #include "../core/Util.hpp"
 #include "../localisation/Language.h"
@@ -55,28 +56,30 @@ static utf8* _password = nullptr;
 static utf8* _userDataPath = nullptr;
 static utf8* _openrctDataPath = nullptr;
 static utf8* _rct2DataPath = nullptr;
+static utf8* _profileTracePath = nullptr;
 static bool _silentBreakpad = false;
 
 // clang-format off
 static constexpr const CommandLineOptionDefinition StandardOptions[]
 {
-    { CMDLINE_TYPE_SWITCH,  &_help,            'h', "help",              "show this help message and exit"                            },
-    { CMDLINE_TYPE_SWITCH,  &_version,         'v', "version",           "show version information and exit"                          },
-    { CMDLINE_TYPE_SWITCH,  &_noInstall,       'n', "no-install",        "do not install scenario if passed"                          },
-    { CMDLINE_TYPE_SWITCH,  &_all,             'a', "all",               "show help for all commands"                                 },
-    { CMDLINE_TYPE_SWITCH,  &_about,           NAC, "about",             "show information about " OPENRCT2_NAME                      },
-    { CMDLINE_TYPE_SWITCH,  &_verbose,         NAC, "verbose",           "log verbose messages"                                       },
-    { CMDLINE_TYPE_SWITCH,  &_headless,        NAC, "headless",          "run " OPENRCT2_NAME " headless" IMPLIES_SILENT_BREAKPAD     },
+    { CMDLINE_TYPE_SWITCH,  &_help,             'h', "help",              "show this help message and exit"                            },
+    { CMDLINE_TYPE_SWITCH,  &_version,          'v', "version",           "show version information and exit"                          },
+    { CMDLINE_TYPE_SWITCH,  &_noInstall,        'n', "no-install",        "do not install scenario if passed"                          },
+    { CMDLINE_TYPE_SWITCH,  &_all,              'a', "all",               "show help for all commands"                                 },
+    { CMDLINE_TYPE_SWITCH,  &_about,            NAC, "about",             "show information about " OPENRCT2_NAME                      },
+    { CMDLINE_TYPE_SWITCH,  &_verbose,          NAC, "verbose",           "log verbose messages"                                       },
+    { CMDLINE_TYPE_SWITCH,  &_headless,         NAC, "headless",          "run " OPENRCT2_NAME " headless" IMPLIES_SILENT_BREAKPAD     },
 #ifndef DISABLE_NETWORK
-    { CMDLINE_TYPE_INTEGER, &_port,            NAC, "port",              "port to use for hosting or joining a server"                },
-    { CMDLINE_TYPE_STRING,  &_address,         NAC, "address",           "address to listen on when hosting a server"                 },
+    { CMDLINE_TYPE_INTEGER, &_port,             NAC, "port",              "port to use for hosting or joining a server"                },
+    { CMDLINE_TYPE_STRING,  &_address,          NAC, "address",           "address to listen on when hosting a server"                 },
 #endif
-    { CMDLINE_TYPE_STRING,  &_password,        NAC, "password",          "password needed to join the server"                         },
-    { CMDLINE_TYPE_STRING,  &_userDataPath,    NAC, "user-data-path",    "path to the user data directory (containing config.ini)"    },
-    { CMDLINE_TYPE_STRING,  &_openrctDataPath, NAC, "openrct-data-path", "path to the OpenRCT2 data directory (containing languages)" },
-    { CMDLINE_TYPE_STRING,  &_rct2DataPath,    NAC, "rct2-data-path",    "path to the RollerCoaster Tycoon 2 data directory (containing data/g1.dat)" },
+    { CMDLINE_TYPE_STRING,  &_password,         NAC, "password",          "password needed to join the server"                         },
+    { CMDLINE_TYPE_STRING,  &_userDataPath,     NAC, "user-data-path",    "path to the user data directory (containing config.ini)"    },
+    { CMDLINE_TYPE_STRING,  &_openrctDataPath,  NAC, "openrct-data-path", "path to the OpenRCT2 data directory (containing languages)" },
+    { CMDLINE_TYPE_STRING,  &_rct2DataPath,     NAC, "rct2-data-path",    "path to the RollerCoaster Tycoon 2 data directory (containing data/g1.dat)" },
+    { CMDLINE_TYPE_STRING,  &_profileTracePath, NAC, "profile-trace",     "write a Chrome trace of the game and paint stages to the given file on exit" },
 #ifdef USE_BREAKPAD
-    { CMDLINE_TYPE_SWITCH,  &_silentBreakpad,  NAC, "silent-breakpad",   "make breakpad crash reporting silent"                       },
+    { CMDLINE_TYPE_SWITCH,  &_silentBreakpad,   NAC, "silent-breakpad",   "make breakpad crash reporting silent"                       },
 #endif // USE_BREAKPAD
     OptionTableEnd
 };
@@ -133,9 +136,10 @@ const CommandLineCommand CommandLine::RootCommands[]
 #endif
 
     // Sub-commands
-    DefineSubCommand("screenshot", CommandLine::ScreenshotCommands),
-    DefineSubCommand("sprite",     CommandLine::SpriteCommands    ),
-    DefineSubCommand("benchgfx",   CommandLine::BenchGfxCommands  ),
+    DefineSubCommand("screenshot",    CommandLine::ScreenshotCommands   ),
+    DefineSubCommand("sprite",        CommandLine::SpriteCommands       ),
+    DefineSubCommand("benchgfx",      CommandLine::BenchGfxCommands     ),
+    DefineSubCommand("benchsimulate", CommandLine::BenchSimulateCommands),
 
     CommandTableEnd
 };
@@ -220,6 +224,14 @@ exitcode_t CommandLine::HandleCommandDefault()
         Memory::Free(_password);
     }
 
+    if (_profileTracePath != nullptr)
+    {
+        utf8 absolutePath[MAX_PATH]{};
+        Path::GetAbsolute(absolutePath, Util::CountOf(absolutePath), _profileTracePath);
+        Profiler::StartTrace(absolutePath);
+        Memory::Free(_profileTracePath);
+    }
+
     return result;
 }
 
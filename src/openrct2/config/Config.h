@@ -41,6 +41,8 @@ struct GeneralConfiguration
     bool upper_case_banners;
     bool render_weather_effects;
     bool render_weather_gloom;
+    bool multithreading;
+    int32_t sprite_cache_size;
     bool disable_lightning_effect;
     bool show_guest_purchases;
 
@@ -14,11 +14,14 @@
 #include "File.h"
 #include "FileScanner.h"
 #include "FileStream.hpp"
-#include "JobPool.hpp"
 #include "Path.hpp"
+#include "TaskScheduler.hpp"
 
+#include <atomic>
 #include <chrono>
+#include <functional>
 #include <list>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -204,7 +207,7 @@ private:
         const size_t totalCount = scanResult.Files.size();
         if (totalCount > 0)
         {
-            JobPool jobPool;
+            TaskGroup taskGroup;
             std::mutex printLock; // For verbose prints.
 
             std::list<std::vector<TItem>> containers;
@@ -227,14 +230,14 @@ private:
 
                 auto& items = containers.emplace_back();
 
-                jobPool.AddTask(std::bind(
+                taskGroup.Run(std::bind(
                     &FileIndex<TItem>::BuildRange, this, language, std::cref(scanResult), rangeStart, rangeStart + stepSize,
                     std::ref(items), std::ref(processed), std::ref(printLock)));
 
                 reportProgress();
             }
 
-            jobPool.Join(reportProgress);
+            taskGroup.Wait(reportProgress);
 
             for (auto&& itr : containers)
             {
@@ -161,7 +161,9 @@ namespace Imaging
         }
     }
 
-    static void WritePng(std::ostream& ostream, const Image& image)
+    static void WritePng(
+        std::ostream& ostream, uint32_t width, uint32_t height, uint32_t depth, const rct_palette* palette,
+        const ImageRowFunc& getRow)
     {
         png_structp png_ptr = nullptr;
         png_colorp png_palette = nullptr;
@@ -179,9 +181,9 @@ namespace Imaging
                 throw std::runtime_error("png_create_info_struct failed.");
             }
 
-            if (image.Depth == 8)
+            if (depth == 8)
             {
-                if (image.Palette == nullptr)
+                if (palette == nullptr)
                 {
                     throw std::runtime_error("Expected a palette for 8-bit image.");
                 }
@@ -194,7 +196,7 @@ namespace Imaging
                 }
                 for (size_t i = 0; i < PNG_MAX_PALETTE_LENGTH; i++)
                 {
-                    const auto entry = &image.Palette->entries[i];
+                    const auto entry = &palette->entries[i];
                     png_palette[i].blue = entry->blue;
                     png_palette[i].green = entry->green;
                     png_palette[i].red = entry->red;
@@ -212,23 +214,21 @@ namespace Imaging
 
             // Write header
             auto colourType = PNG_COLOR_TYPE_RGB_ALPHA;
-            if (image.Depth == 8)
+            if (depth == 8)
             {
                 png_byte transparentIndex = 0;
                 png_set_tRNS(png_ptr, info_ptr, &transparentIndex, 1, nullptr);
                 colourType = PNG_COLOR_TYPE_PALETTE;
             }
             png_set_IHDR(
-                png_ptr, info_ptr, image.Width, image.Height, 8, colourType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+                png_ptr, info_ptr, width, height, 8, colourType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
                 PNG_FILTER_TYPE_DEFAULT);
             png_write_info(png_ptr, info_ptr);
 
             // Write pixels
-            auto pixels = image.Pixels.data();
-            for (uint32_t y = 0; y < image.Height; y++)
+            for (uint32_t y = 0; y < height; y++)
             {
-                png_write_row(png_ptr, (png_byte*)pixels);
-                pixels += image.Stride;
+                png_write_row(png_ptr, (png_byte*)getRow(y));
             }
 
             png_write_end(png_ptr, nullptr);
@@ -243,6 +243,15 @@ namespace Imaging
         }
     }
 
+    static void WritePng(std::ostream& ostream, const Image& image)
+    {
+        auto pixels = image.Pixels.data();
+        auto stride = image.Stride;
+        WritePng(ostream, image.Width, image.Height, image.Depth, image.Palette.get(), [pixels, stride](uint32_t y) {
+            return pixels + (y * stride);
+        });
+    }
+
     IMAGE_FORMAT GetImageFormatFromPath(const std::string_view& path)
     {
         if (String::EndsWith(path, ".png", true))
@@ -343,4 +352,16 @@ namespace Imaging
                 throw std::runtime_error(EXCEPTION_IMAGE_FORMAT_UNKNOWN);
         }
     }
+
+    void WriteRowsToFile(
+        const std::string_view& path, uint32_t width, uint32_t height, const rct_palette& palette, const ImageRowFunc& getRow)
+    {
+#if defined(_WIN32) && !defined(__MINGW32__)
+        auto pathW = String::ToUtf16(path);
+        std::ofstream fs(pathW, std::ios::binary);
+#else
+        std::ofstream fs(path.data(), std::ios::binary);
+#endif
+        WritePng(fs, width, height, 8, &palette, getRow);
+    }
 } // namespace Imaging
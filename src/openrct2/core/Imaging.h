@@ -52,6 +52,7 @@ struct Image
 };
 
 using ImageReaderFunc = std::function<Image(std::istream&, IMAGE_FORMAT)>;
+using ImageRowFunc = std::function<const uint8_t*(uint32_t y)>;
 
 namespace Imaging
 {
@@ -60,5 +61,12 @@ namespace Imaging
     Image ReadFromBuffer(const std::vector<uint8_t>& buffer, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
     void WriteToFile(const std::string_view& path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
 
+    /**
+     * Writes an 8-bit PNG, requesting each row from getRow in order just before it is encoded so that the whole
+     * image never has to be held in memory.
+     */
+    void WriteRowsToFile(
+        const std::string_view& path, uint32_t width, uint32_t height, const rct_palette& palette, const ImageRowFunc& getRow);
+
     void SetReader(IMAGE_FORMAT format, ImageReaderFunc impl);
 } // namespace Imaging
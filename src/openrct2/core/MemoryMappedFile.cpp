@@ -0,0 +1,101 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef _WIN32
+#    define WIN32_LEAN_AND_MEAN
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include "IStream.hpp"
+#include "MemoryMappedFile.h"
+#include "String.hpp"
+
+#ifdef _WIN32
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path)
+{
+    auto pathW = String::ToUtf16(path);
+    HANDLE file = CreateFileW(
+        pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw IOException("Unable to open " + path);
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        throw IOException("Unable to get the size of " + path);
+    }
+
+    // The view keeps the mapping and the file open, so the handles can be closed straight away
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+    {
+        throw IOException("Unable to map " + path);
+    }
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (data == nullptr)
+    {
+        throw IOException("Unable to map " + path);
+    }
+
+    _data = (const uint8_t*)data;
+    _size = (size_t)fileSize.QuadPart;
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    UnmapViewOfFile((void*)_data);
+}
+
+#else
+
+MemoryMappedFile::MemoryMappedFile(const std::string& path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw IOException("Unable to open " + path);
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        close(fd);
+        throw IOException("Unable to get the size of " + path);
+    }
+
+    // The mapping keeps the file open, so the descriptor can be closed straight away
+    size_t size = (size_t)fileStat.st_size;
+    void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        throw IOException("Unable to map " + path);
+    }
+
+    _data = (const uint8_t*)data;
+    _size = size;
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    munmap((void*)_data, _size);
+}
+
+#endif
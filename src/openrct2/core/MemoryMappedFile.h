@@ -0,0 +1,41 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <string>
+
+/**
+ * Maps a whole file into memory read only. The pages are shared with every other process that maps the same file and
+ * writing to them crashes.
+ */
+class MemoryMappedFile final
+{
+private:
+    const uint8_t* _data = nullptr;
+    size_t _size = 0;
+
+public:
+    explicit MemoryMappedFile(const std::string& path);
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+    ~MemoryMappedFile();
+
+    const uint8_t* GetData() const
+    {
+        return _data;
+    }
+
+    size_t GetSize() const
+    {
+        return _size;
+    }
+};
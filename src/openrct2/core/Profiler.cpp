@@ -0,0 +1,251 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Profiler.hpp"
+
+#include "../Diagnostic.h"
+#include "FileStream.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+namespace
+{
+    struct ProfilerNode
+    {
+        const char* Name;
+        int32_t Parent;
+        int32_t Depth;
+        double FrameMs;
+        uint32_t FrameCalls;
+        double AverageMs;
+        double PeakMs;
+        uint32_t Calls;
+    };
+
+    struct TraceEvent
+    {
+        const char* Name;
+        uint32_t ThreadId;
+        double StartUs;
+        double DurationUs;
+    };
+
+    // Roughly a 20 frame window for the averages, peaks fade out over a few seconds
+    constexpr double AVERAGE_WEIGHT = 0.05;
+    constexpr double PEAK_DECAY = 0.98;
+
+    // Stop recording rather than grow without bound when a trace is left running
+    constexpr size_t MAX_TRACE_EVENTS = 1024 * 1024;
+
+    std::atomic_bool _enabled = { false };
+    std::atomic_bool _tracing = { false };
+    std::atomic<uint32_t> _nextThreadId = { 1 };
+
+    // Guards the nodes and the trace, scopes only cover whole stages so contention is low
+    std::mutex _mutex;
+    std::vector<ProfilerNode> _nodes;
+    std::vector<TraceEvent> _traceEvents;
+    std::string _tracePath;
+    Profiler::Clock::time_point _traceStart;
+
+    thread_local int32_t _currentScope = -1;
+    thread_local uint32_t _threadId = _nextThreadId++;
+
+    int32_t FindOrAddNode(const char* name, int32_t parent)
+    {
+        for (size_t i = 0; i < _nodes.size(); i++)
+        {
+            const auto& node = _nodes[i];
+            if (node.Name == name && node.Parent == parent)
+            {
+                return (int32_t)i;
+            }
+        }
+
+        int32_t depth = parent == -1 ? 0 : _nodes[parent].Depth + 1;
+        _nodes.push_back({ name, parent, depth, 0, 0, 0, 0, 0 });
+        return (int32_t)(_nodes.size() - 1);
+    }
+
+    void AppendStageTimings(std::vector<Profiler::StageTiming>& timings, int32_t parent)
+    {
+        for (size_t i = 0; i < _nodes.size(); i++)
+        {
+            const auto& node = _nodes[i];
+            if (node.Parent == parent)
+            {
+                timings.push_back({ node.Name, node.Depth, node.AverageMs, node.PeakMs, node.Calls });
+                AppendStageTimings(timings, (int32_t)i);
+            }
+        }
+    }
+
+    void WriteTrace(const std::string& path, const std::vector<TraceEvent>& events)
+    {
+        auto fs = FileStream(path, FILE_MODE_WRITE);
+
+        const char* header = "{\"traceEvents\":[\n";
+        fs.Write(header, std::strlen(header));
+        for (size_t i = 0; i < events.size(); i++)
+        {
+            const auto& e = events[i];
+            char buffer[256];
+            int32_t length = std::snprintf(
+                buffer, sizeof(buffer),
+                "%s{\"name\":\"%s\",\"cat\":\"openrct2\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}\n",
+                i == 0 ? "" : ",", e.Name, e.StartUs, e.DurationUs, e.ThreadId);
+            fs.Write(buffer, std::min<size_t>(length, sizeof(buffer) - 1));
+        }
+        const char* footer = "]}\n";
+        fs.Write(footer, std::strlen(footer));
+    }
+} // namespace
+
+namespace Profiler
+{
+    std::atomic_bool Active = { false };
+
+    bool IsEnabled()
+    {
+        return _enabled;
+    }
+
+    void SetEnabled(bool value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (value && !_enabled)
+        {
+            // Start the averages afresh rather than from whenever the overlay was last shown
+            for (auto& node : _nodes)
+            {
+                node.FrameMs = 0;
+                node.FrameCalls = 0;
+                node.AverageMs = 0;
+                node.PeakMs = 0;
+                node.Calls = 0;
+            }
+        }
+        _enabled = value;
+        Active = _enabled || _tracing;
+    }
+
+    void EndFrame()
+    {
+        if (!_enabled)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto& node : _nodes)
+        {
+            node.AverageMs += (node.FrameMs - node.AverageMs) * AVERAGE_WEIGHT;
+            node.PeakMs = std::max(node.FrameMs, node.PeakMs * PEAK_DECAY);
+            node.Calls = node.FrameCalls;
+            node.FrameMs = 0;
+            node.FrameCalls = 0;
+        }
+    }
+
+    std::vector<StageTiming> GetStageTimings()
+    {
+        std::vector<StageTiming> timings;
+        std::lock_guard<std::mutex> lock(_mutex);
+        timings.reserve(_nodes.size());
+        AppendStageTimings(timings, -1);
+        return timings;
+    }
+
+    void StartTrace(const std::string& path)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tracePath = path;
+        _traceEvents.clear();
+        _traceStart = Clock::now();
+        _tracing = true;
+        Active = true;
+    }
+
+    bool StopTrace()
+    {
+        if (!_tracing)
+        {
+            return false;
+        }
+
+        std::vector<TraceEvent> events;
+        std::string path;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _tracing = false;
+            Active = _enabled.load();
+            events = std::move(_traceEvents);
+            _traceEvents = {};
+            path = std::move(_tracePath);
+        }
+
+        if (events.size() >= MAX_TRACE_EVENTS)
+        {
+            log_warning("Trace reached %zu events, later events were not recorded.", MAX_TRACE_EVENTS);
+        }
+
+        try
+        {
+            WriteTrace(path, events);
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            log_error("Unable to write trace: %s", e.what());
+            return false;
+        }
+    }
+
+    int32_t GetCurrentScope()
+    {
+        return _currentScope;
+    }
+
+    void SetCurrentScope(int32_t scope)
+    {
+        _currentScope = scope;
+    }
+
+    void ScopedTimer::Begin(const char* name)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _node = FindOrAddNode(name, _currentScope);
+        }
+        _parent = _currentScope;
+        _currentScope = _node;
+        _start = Clock::now();
+    }
+
+    void ScopedTimer::End()
+    {
+        auto end = Clock::now();
+        _currentScope = _parent;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto& node = _nodes[_node];
+        node.FrameMs += std::chrono::duration<double, std::milli>(end - _start).count();
+        node.FrameCalls++;
+        if (_tracing && _traceEvents.size() < MAX_TRACE_EVENTS)
+        {
+            double startUs = std::chrono::duration<double, std::micro>(_start - _traceStart).count();
+            double durationUs = std::chrono::duration<double, std::micro>(end - _start).count();
+            _traceEvents.push_back({ node.Name, _threadId, startUs, durationUs });
+        }
+    }
+} // namespace Profiler
@@ -0,0 +1,99 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+/**
+ * A lightweight hierarchical profiler for the main game stages. Scopes nest by the order they are opened on each
+ * thread, tasks run through the task scheduler inherit the scope that queued them. Scopes cost a single relaxed atomic
+ * load unless the overlay is shown or a trace is being captured, in which case they take a lock to record their time.
+ */
+namespace Profiler
+{
+    using Clock = std::chrono::high_resolution_clock;
+
+    struct StageTiming
+    {
+        const char* Name;
+        int32_t Depth;
+        double AverageMs;
+        double PeakMs;
+        uint32_t Calls;
+    };
+
+    // Set while the overlay is shown or a trace is being captured, only read through IsActive
+    extern std::atomic_bool Active;
+
+    bool IsEnabled();
+    void SetEnabled(bool value);
+
+    inline bool IsActive()
+    {
+        return Active.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Folds the time spent in each stage since the last call into its rolling average. Should be called once per frame.
+     */
+    void EndFrame();
+
+    /**
+     * Gets the rolling timings of every stage seen so far, ordered so that each stage follows its parent.
+     */
+    std::vector<StageTiming> GetStageTimings();
+
+    /**
+     * Starts recording every scope into a Chrome trace (chrome://tracing) that is written to the given path by StopTrace.
+     */
+    void StartTrace(const std::string& path);
+    bool StopTrace();
+
+    // Used to carry the current scope over to tasks running on other threads
+    int32_t GetCurrentScope();
+    void SetCurrentScope(int32_t scope);
+
+    class ScopedTimer final
+    {
+    private:
+        Clock::time_point _start;
+        int32_t _node = -1;
+        int32_t _parent = -1;
+
+    public:
+        explicit ScopedTimer(const char* name)
+        {
+            if (IsActive())
+            {
+                Begin(name);
+            }
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        ~ScopedTimer()
+        {
+            if (_node != -1)
+            {
+                End();
+            }
+        }
+
+    private:
+        void Begin(const char* name);
+        void End();
+    };
+} // namespace Profiler
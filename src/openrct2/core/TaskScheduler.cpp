@@ -0,0 +1,276 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TaskScheduler.hpp"
+
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Task
+    {
+        std::function<void()> Fn;
+        TaskGroup* Group = nullptr;
+    };
+
+    struct WorkQueue
+    {
+        std::mutex Mutex;
+        std::deque<Task> Tasks;
+    };
+
+    // Index of the queue owned by the current thread, threads outside the scheduler use the shared queue
+    thread_local size_t _threadQueueIndex = 0;
+
+    class Scheduler
+    {
+    private:
+        // Queue 0 is shared by all threads that are not workers, the rest belong to one worker each
+        std::vector<std::unique_ptr<WorkQueue>> _queues;
+        std::vector<std::thread> _threads;
+        std::atomic<size_t> _queuedCount = { 0 };
+        std::atomic_bool _shouldStop = { false };
+        std::mutex _sleepMutex;
+        std::condition_variable _sleepCondition;
+
+    public:
+        Scheduler()
+        {
+            size_t numWorkers = std::max<size_t>(1, std::thread::hardware_concurrency()) - 1;
+            numWorkers = std::max<size_t>(1, numWorkers);
+            for (size_t i = 0; i <= numWorkers; i++)
+            {
+                _queues.push_back(std::make_unique<WorkQueue>());
+            }
+            for (size_t i = 1; i <= numWorkers; i++)
+            {
+                _threads.emplace_back(&Scheduler::ProcessQueues, this, i);
+            }
+        }
+
+        ~Scheduler()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_sleepMutex);
+                _shouldStop = true;
+            }
+            _sleepCondition.notify_all();
+            for (auto& th : _threads)
+            {
+                th.join();
+            }
+        }
+
+        size_t GetConcurrency() const
+        {
+            return _threads.size() + 1;
+        }
+
+        void Push(Task&& task)
+        {
+            // Count the task before it becomes visible so that the count can not drop below zero
+            {
+                std::lock_guard<std::mutex> lock(_sleepMutex);
+                _queuedCount++;
+            }
+            auto& queue = *_queues[_threadQueueIndex];
+            {
+                std::lock_guard<std::mutex> lock(queue.Mutex);
+                queue.Tasks.push_back(std::move(task));
+            }
+            _sleepCondition.notify_one();
+        }
+
+        /**
+         * Runs tasks on the calling thread until the group is complete, sleeping when there is nothing to steal.
+         */
+        void WaitFor(const TaskGroup& group, const std::function<void()>& reportFn)
+        {
+            while (!group.IsComplete())
+            {
+                if (!TryRunTask())
+                {
+                    std::unique_lock<std::mutex> lock(_sleepMutex);
+                    _sleepCondition.wait_for(lock, std::chrono::milliseconds(50), [this, &group]() {
+                        return group.IsComplete() || _queuedCount > 0;
+                    });
+                }
+                if (reportFn)
+                {
+                    reportFn();
+                }
+            }
+        }
+
+        void NotifyGroupComplete()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_sleepMutex);
+            }
+            _sleepCondition.notify_all();
+        }
+
+    private:
+        bool TryPop(Task& task)
+        {
+            // Take the most recently queued task of our own, it is the most likely to still be in cache
+            auto& queue = *_queues[_threadQueueIndex];
+            std::lock_guard<std::mutex> lock(queue.Mutex);
+            if (queue.Tasks.empty())
+            {
+                return false;
+            }
+            task = std::move(queue.Tasks.back());
+            queue.Tasks.pop_back();
+            return true;
+        }
+
+        bool TrySteal(Task& task)
+        {
+            // Take the oldest task from another queue, starting with the one after ours
+            for (size_t i = 1; i < _queues.size(); i++)
+            {
+                auto& queue = *_queues[(_threadQueueIndex + i) % _queues.size()];
+                std::lock_guard<std::mutex> lock(queue.Mutex);
+                if (!queue.Tasks.empty())
+                {
+                    task = std::move(queue.Tasks.front());
+                    queue.Tasks.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool TryRunTask()
+        {
+            Task task;
+            if (!TryPop(task) && !TrySteal(task))
+            {
+                return false;
+            }
+            _queuedCount--;
+            try
+            {
+                task.Fn();
+            }
+            catch (...)
+            {
+                // Keep the exception for the waiting thread, the group must still complete or it is waited on forever
+                task.Group->OnTaskException(std::current_exception());
+            }
+            task.Group->OnTaskComplete();
+            return true;
+        }
+
+        void ProcessQueues(size_t queueIndex)
+        {
+            _threadQueueIndex = queueIndex;
+            while (!_shouldStop)
+            {
+                if (!TryRunTask())
+                {
+                    std::unique_lock<std::mutex> lock(_sleepMutex);
+                    _sleepCondition.wait(lock, [this]() { return _shouldStop || _queuedCount > 0; });
+                }
+            }
+        }
+    };
+
+    Scheduler& GetScheduler()
+    {
+        static Scheduler scheduler;
+        return scheduler;
+    }
+} // namespace
+
+TaskGroup::~TaskGroup()
+{
+    // Destructors can not throw, so exceptions not collected by a call to Wait are dropped
+    GetScheduler().WaitFor(*this, nullptr);
+}
+
+void TaskGroup::Run(std::function<void()> fn)
+{
+    // Let scopes opened by the task nest under the scope that queued it
+    int32_t profilerScope = Profiler::GetCurrentScope();
+    if (profilerScope != -1)
+    {
+        fn = [fn = std::move(fn), profilerScope]() {
+            int32_t previousScope = Profiler::GetCurrentScope();
+            Profiler::SetCurrentScope(profilerScope);
+            fn();
+            Profiler::SetCurrentScope(previousScope);
+        };
+    }
+
+    _pending++;
+    GetScheduler().Push({ std::move(fn), this });
+}
+
+void TaskGroup::Wait(const std::function<void()>& reportFn)
+{
+    GetScheduler().WaitFor(*this, reportFn);
+
+    std::exception_ptr exception;
+    {
+        std::lock_guard<std::mutex> lock(_exceptionMutex);
+        std::swap(exception, _exception);
+    }
+    if (exception != nullptr)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+void TaskGroup::OnTaskException(std::exception_ptr exception)
+{
+    std::lock_guard<std::mutex> lock(_exceptionMutex);
+    if (_exception == nullptr)
+    {
+        _exception = exception;
+    }
+}
+
+void TaskGroup::OnTaskComplete()
+{
+    if (--_pending == 0)
+    {
+        GetScheduler().NotifyGroupComplete();
+    }
+}
+
+namespace TaskScheduler
+{
+    size_t GetConcurrency()
+    {
+        return GetScheduler().GetConcurrency();
+    }
+
+    void ParallelFor(size_t begin, size_t end, size_t grainSize, const std::function<void(size_t, size_t)>& fn)
+    {
+        grainSize = std::max<size_t>(1, grainSize);
+        TaskGroup group;
+        for (size_t rangeStart = begin; rangeStart < end; rangeStart += grainSize)
+        {
+            size_t rangeEnd = std::min(end, rangeStart + grainSize);
+            group.Run([&fn, rangeStart, rangeEnd]() { fn(rangeStart, rangeEnd); });
+        }
+        group.Wait();
+    }
+} // namespace TaskScheduler
@@ -0,0 +1,66 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+
+/**
+ * A set of tasks that can be waited on together. Tasks are executed by the process wide task scheduler, which keeps
+ * a deque of tasks per worker thread and lets idle workers steal from the others. A thread waiting on a group runs
+ * pending tasks itself rather than blocking, so groups can be waited on from within other tasks.
+ */
+class TaskGroup
+{
+private:
+    std::atomic<size_t> _pending = { 0 };
+    std::mutex _exceptionMutex;
+    std::exception_ptr _exception;
+
+public:
+    TaskGroup() = default;
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+    ~TaskGroup();
+
+    void Run(std::function<void()> fn);
+
+    /**
+     * Waits for all the tasks in the group to finish. The report function, if given, is called periodically from the
+     * waiting thread, e.g. to print progress. If a task threw an exception, the first one is rethrown once all the
+     * other tasks have finished.
+     */
+    void Wait(const std::function<void()>& reportFn = nullptr);
+
+    // Used by the scheduler
+    void OnTaskException(std::exception_ptr exception);
+    void OnTaskComplete();
+    bool IsComplete() const
+    {
+        return _pending == 0;
+    }
+};
+
+namespace TaskScheduler
+{
+    /**
+     * Gets the number of threads that execute tasks, including the thread that waits on a task group.
+     */
+    size_t GetConcurrency();
+
+    /**
+     * Splits [begin, end) into ranges of at most grainSize indices and calls fn for each range in parallel. Returns
+     * once every range has been processed.
+     */
+    void ParallelFor(size_t begin, size_t end, size_t grainSize, const std::function<void(size_t, size_t)>& fn);
+} // namespace TaskScheduler
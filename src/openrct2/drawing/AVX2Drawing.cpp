@@ -42,6 +42,74 @@ void mask_avx2(
     }
 }
 
+void blit_copy_nonzero_avx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count)
+{
+    const __m256i zero = {};
+    int32_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i pixels = _mm256_loadu_si256((const __m256i*)(src + i));
+        const __m256i dest = _mm256_loadu_si256((const __m256i*)(dst + i));
+        const __m256i transparent = _mm256_cmpeq_epi8(pixels, zero);
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_blendv_epi8(pixels, dest, transparent));
+    }
+    blit_copy_nonzero_scalar(src + i, dst + i, count - i);
+}
+
+void blit_copy_zoomed_avx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, int32_t zoomLevel)
+{
+    // Unzoomed copies are left to the scalar version's memcpy. The loops stop one vector early so that the loads
+    // never read past the last sampled source pixel
+    int32_t i = 0;
+    if (zoomLevel == 1)
+    {
+        const __m256i lowBytes = _mm256_set1_epi16(0x00FF);
+        for (; i + 32 < count; i += 32)
+        {
+            const uint8_t* s = src + (i << 1);
+            const __m256i a = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)s), lowBytes);
+            const __m256i b = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(s + 32)), lowBytes);
+            // Packing works within each 128 bit lane, so the 64 bit quarters come out as a0 b0 a1 b1
+            const __m256i packed = _mm256_packus_epi16(a, b);
+            _mm256_storeu_si256((__m256i*)(dst + i), _mm256_permute4x64_epi64(packed, 0xD8));
+        }
+    }
+    else if (zoomLevel == 2)
+    {
+        const __m256i lowBytes = _mm256_set1_epi32(0xFF);
+        const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        for (; i + 32 < count; i += 32)
+        {
+            const uint8_t* s = src + (i << 2);
+            const __m256i a = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)s), lowBytes);
+            const __m256i b = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(s + 32)), lowBytes);
+            const __m256i c = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(s + 64)), lowBytes);
+            const __m256i d = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(s + 96)), lowBytes);
+            // As above, the 32 bit eighths come out as a0 b0 c0 d0 a1 b1 c1 d1
+            const __m256i packed = _mm256_packus_epi16(_mm256_packus_epi32(a, b), _mm256_packus_epi32(c, d));
+            _mm256_storeu_si256((__m256i*)(dst + i), _mm256_permutevar8x32_epi32(packed, order));
+        }
+    }
+    blit_copy_zoomed_scalar(src + (i << zoomLevel), dst + i, count - i, zoomLevel);
+}
+
+void blit_fill_pattern_avx2(uint8_t* dst, int32_t count, uint8_t colour, uint16_t pattern)
+{
+    // Spread the 16 pattern bits over 16 bytes and repeat them in both lanes
+    const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i spread = _mm_shuffle_epi8(
+        _mm_cvtsi32_si128(pattern), _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1));
+    const __m256i mask = _mm256_broadcastsi128_si256(_mm_cmpeq_epi8(_mm_and_si128(spread, bits), bits));
+    const __m256i fill = _mm256_set1_epi8((char)colour);
+    int32_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i dest = _mm256_loadu_si256((const __m256i*)(dst + i));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_blendv_epi8(dest, fill, mask));
+    }
+    blit_fill_pattern_scalar(dst + i, count - i, colour, pattern);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -55,4 +123,19 @@ void mask_avx2(
     openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void blit_copy_nonzero_avx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void blit_copy_zoomed_avx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, int32_t zoomLevel)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void blit_fill_pattern_avx2(uint8_t* dst, int32_t count, uint8_t colour, uint16_t pattern)
+{
+    openrct2_assert(false, "AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
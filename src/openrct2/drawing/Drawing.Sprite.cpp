@@ -12,19 +12,23 @@
 #include "../PlatformEnvironment.h"
 #include "../config/Config.h"
 #include "../core/FileStream.hpp"
+#include "../core/MemoryMappedFile.h"
 #include "../core/Path.hpp"
 #include "../platform/platform.h"
 #include "../sprites.h"
 #include "../ui/UiContext.h"
 #include "../util/Util.h"
 #include "Drawing.h"
+#include "SpriteCache.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
 #include <vector>
 
 using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
 using namespace OpenRCT2::Ui;
 
 #pragma pack(push, 1)
@@ -41,6 +45,8 @@ struct rct_gx
     rct_g1_header header;
     std::vector<rct_g1_element> elements;
     void* data;
+    // Set when data points into a mapping of the file rather than a heap copy
+    std::unique_ptr<MemoryMappedFile> mapping;
 };
 
 // clang-format off
@@ -193,6 +199,46 @@ void mask_scalar(
     }
 }
 
+void blit_copy_nonzero_scalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        uint8_t pixel = src[i];
+        if (pixel != 0)
+        {
+            dst[i] = pixel;
+        }
+    }
+}
+
+void blit_copy_zoomed_scalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, int32_t zoomLevel)
+{
+    if (zoomLevel == 0)
+    {
+        // The buffers may be null when there is nothing to copy, which memcpy does not allow
+        if (count > 0)
+        {
+            std::memcpy(dst, src, count);
+        }
+        return;
+    }
+    for (int32_t i = 0; i < count; i++)
+    {
+        dst[i] = src[i << zoomLevel];
+    }
+}
+
+void blit_fill_pattern_scalar(uint8_t* dst, int32_t count, uint8_t colour, uint16_t pattern)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (pattern & (1 << (i & 15)))
+        {
+            dst[i] = colour;
+        }
+    }
+}
+
 static std::string gfx_get_csg_header_path()
 {
     auto path = Path::ResolveCasing(Path::Combine(gConfigGeneral.rct1_path, "Data", "csg1i.dat"));
@@ -225,6 +271,46 @@ static bool _csgLoaded = false;
 static rct_g1_element _g1Temp = {};
 bool gTinyFontAntiAliased = false;
 
+/**
+ * Loads the element data that follows the current position of the given file. The file is mapped into memory where
+ * possible, so that its pages are shared by every process drawing from it rather than read into each of them.
+ */
+static void gfx_load_gx_data(rct_gx& gx, IStream& stream, const std::string& path)
+{
+    auto dataOffset = stream.GetPosition();
+    try
+    {
+        auto mapping = std::make_unique<MemoryMappedFile>(path);
+        if (mapping->GetSize() < dataOffset + gx.header.total_size)
+        {
+            throw IOException("Not enough data in " + path);
+        }
+        // The elements point into the data without const, but element data is never written to
+        gx.data = (void*)(mapping->GetData() + dataOffset);
+        gx.mapping = std::move(mapping);
+    }
+    catch (const std::exception& e)
+    {
+        log_verbose("Unable to map %s, reading it instead: %s", path.c_str(), e.what());
+        gx.data = stream.ReadArray<uint8_t>(gx.header.total_size);
+    }
+}
+
+static void gfx_unload_gx(rct_gx& gx)
+{
+    if (gx.mapping != nullptr)
+    {
+        gx.mapping = nullptr;
+        gx.data = nullptr;
+    }
+    else
+    {
+        SafeFree(gx.data);
+    }
+    gx.elements.clear();
+    gx.elements.shrink_to_fit();
+}
+
 /**
  *
  *  rct2: 0x00678998
@@ -252,7 +338,7 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
         gTinyFontAntiAliased = is_rctc;
 
         // Read element data
-        _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
+        gfx_load_gx_data(_g1, fs, path);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g1.header.num_entries; i++)
@@ -278,23 +364,17 @@ bool gfx_load_g1(const IPlatformEnvironment& env)
 
 void gfx_unload_g1()
 {
-    SafeFree(_g1.data);
-    _g1.elements.clear();
-    _g1.elements.shrink_to_fit();
+    gfx_unload_gx(_g1);
 }
 
 void gfx_unload_g2()
 {
-    SafeFree(_g2.data);
-    _g2.elements.clear();
-    _g2.elements.shrink_to_fit();
+    gfx_unload_gx(_g2);
 }
 
 void gfx_unload_csg()
 {
-    SafeFree(_csg.data);
-    _csg.elements.clear();
-    _csg.elements.shrink_to_fit();
+    gfx_unload_gx(_csg);
 }
 
 bool gfx_load_g2()
@@ -315,7 +395,7 @@ bool gfx_load_g2()
         read_and_convert_gxdat(&fs, _g2.header.num_entries, false, _g2.elements.data());
 
         // Read element data
-        _g2.data = fs.ReadArray<uint8_t>(_g2.header.total_size);
+        gfx_load_gx_data(_g2, fs, path);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g2.header.num_entries; i++)
@@ -372,7 +452,7 @@ bool gfx_load_csg()
         read_and_convert_gxdat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
 
         // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
+        gfx_load_gx_data(_csg, fileData, pathDataPath);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _csg.header.num_entries; i++)
@@ -475,10 +555,9 @@ void FASTCALL gfx_bmp_sprite_to_buffer(
             uint8_t* next_source_pointer = source_pointer + source_line_width;
             uint8_t* next_dest_pointer = dest_pointer + dest_line_width;
 
-            for (int32_t no_pixels = width; no_pixels > 0;
-                 no_pixels -= zoom_amount, dest_pointer++, source_pointer += zoom_amount)
+            if (width > 0)
             {
-                *dest_pointer = *source_pointer;
+                blit_copy_zoomed_fn(source_pointer, dest_pointer, (width + zoom_amount - 1) >> zoom_level, zoom_level);
             }
 
             dest_pointer = next_dest_pointer;
@@ -493,12 +572,20 @@ void FASTCALL gfx_bmp_sprite_to_buffer(
         uint8_t* next_source_pointer = source_pointer + source_line_width;
         uint8_t* next_dest_pointer = dest_pointer + dest_line_width;
 
-        for (int32_t no_pixels = width; no_pixels > 0; no_pixels -= zoom_amount, dest_pointer++, source_pointer += zoom_amount)
+        if (zoom_level == 0)
         {
-            uint8_t pixel = *source_pointer;
-            if (pixel)
+            blit_copy_nonzero_fn(source_pointer, dest_pointer, width);
+        }
+        else
+        {
+            for (int32_t no_pixels = width; no_pixels > 0;
+                 no_pixels -= zoom_amount, dest_pointer++, source_pointer += zoom_amount)
             {
-                *dest_pointer = pixel;
+                uint8_t pixel = *source_pointer;
+                if (pixel)
+                {
+                    *dest_pointer = pixel;
+                }
             }
         }
         dest_pointer = next_dest_pointer;
@@ -582,7 +669,8 @@ uint8_t* FASTCALL gfx_draw_sprite_get_palette(int32_t image_id, uint32_t tertiar
  * dpi (esi)
  * tertiary_colour (ebp)
  */
-void FASTCALL gfx_draw_sprite_software(rct_drawpixelinfo* dpi, int32_t image_id, int32_t x, int32_t y, uint32_t tertiary_colour)
+void FASTCALL gfx_draw_sprite_software(
+    rct_drawpixelinfo* dpi, int32_t image_id, int32_t x, int32_t y, uint32_t tertiary_colour, SpriteCache* spriteCache)
 {
     if (image_id != -1)
     {
@@ -592,8 +680,45 @@ void FASTCALL gfx_draw_sprite_software(rct_drawpixelinfo* dpi, int32_t image_id,
             image_id |= IMAGE_TYPE_REMAP;
         }
 
-        gfx_draw_sprite_palette_set_software(dpi, image_id, x, y, palette_pointer, nullptr);
+        gfx_draw_sprite_palette_set_software(dpi, image_id, x, y, palette_pointer, nullptr, spriteCache);
+    }
+}
+
+/**
+ * Draws a zoomed out RLE sprite from its prescaled copy, which only holds the pixels the zoom level samples. The
+ * prescaled copy is drawn unzoomed so every run becomes a straight copy. Returns false if the cache is disabled.
+ */
+static bool gfx_draw_prescaled_rle_sprite(
+    SpriteCache& spriteCache, int32_t image_element, const rct_g1_element* g1, uint8_t* dest_pointer,
+    const uint8_t* palette_pointer, const rct_drawpixelinfo* dpi, int32_t image_type, int32_t source_start_y, int32_t height,
+    int32_t source_start_x, int32_t width)
+{
+    int32_t zoom_level = dpi->zoom_level;
+    int32_t zoom_amount = 1 << zoom_level;
+
+    // Same adjustment as gfx_rle_sprite_to_buffer makes for a negative source y, so that both sample the same rows
+    if (source_start_y < 0)
+    {
+        source_start_y += zoom_amount;
+        height -= zoom_amount;
+        dest_pointer += (dpi->width >> zoom_level) + dpi->pitch;
+    }
+
+    int32_t phase_x = source_start_x & (zoom_amount - 1);
+    int32_t phase_y = source_start_y & (zoom_amount - 1);
+    auto sprite = spriteCache.GetPrescaled(image_element, g1, zoom_level, phase_x, phase_y);
+    if (sprite == nullptr)
+    {
+        return false;
     }
+
+    rct_drawpixelinfo prescaled_dpi = *dpi;
+    prescaled_dpi.width = dpi->width >> zoom_level;
+    prescaled_dpi.zoom_level = 0;
+    gfx_rle_sprite_to_buffer(
+        sprite->Data.data(), dest_pointer, palette_pointer, &prescaled_dpi, image_type, source_start_y >> zoom_level,
+        (height + zoom_amount - 1) >> zoom_level, source_start_x >> zoom_level, (width + zoom_amount - 1) >> zoom_level);
+    return true;
 }
 
 /*
@@ -606,7 +731,8 @@ void FASTCALL gfx_draw_sprite_software(rct_drawpixelinfo* dpi, int32_t image_id,
  * y (dx)
  */
 void FASTCALL gfx_draw_sprite_palette_set_software(
-    rct_drawpixelinfo* dpi, int32_t image_id, int32_t x, int32_t y, uint8_t* palette_pointer, uint8_t* unknown_pointer)
+    rct_drawpixelinfo* dpi, int32_t image_id, int32_t x, int32_t y, uint8_t* palette_pointer, uint8_t* unknown_pointer,
+    SpriteCache* spriteCache)
 {
     int32_t image_element = image_id & 0x7FFFF;
     int32_t image_type = image_id & 0xE0000000;
@@ -628,7 +754,8 @@ void FASTCALL gfx_draw_sprite_palette_set_software(
         zoomed_dpi.pitch = dpi->pitch;
         zoomed_dpi.zoom_level = dpi->zoom_level - 1;
         gfx_draw_sprite_palette_set_software(
-            &zoomed_dpi, image_type | (image_element - g1->zoomed_offset), x >> 1, y >> 1, palette_pointer, unknown_pointer);
+            &zoomed_dpi, image_type | (image_element - g1->zoomed_offset), x >> 1, y >> 1, palette_pointer, unknown_pointer,
+            spriteCache);
         return;
     }
 
@@ -755,6 +882,13 @@ void FASTCALL gfx_draw_sprite_palette_set_software(
     {
         // We have to use a different method to move the source pointer for
         // rle encoded sprites so that will be handled within this function
+        if (zoom_level != 0 && spriteCache != nullptr
+            && gfx_draw_prescaled_rle_sprite(
+                *spriteCache, image_element, g1, dest_pointer, palette_pointer, dpi, image_type, source_start_y, height,
+                source_start_x, width))
+        {
+            return;
+        }
         gfx_rle_sprite_to_buffer(
             g1->offset, dest_pointer, palette_pointer, dpi, image_type, source_start_y, height, source_start_x, width);
         return;
@@ -38,7 +38,7 @@ int32_t gPickupPeepY;
  * rct2: 0x0009ABE0C
  */
 // clang-format off
-uint8_t gPeepPalette[256] = {
+thread_local uint8_t gPeepPalette[256] = {
     0x00, 0xF3, 0xF4, 0xF5, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
     0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
     0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
@@ -58,7 +58,7 @@ uint8_t gPeepPalette[256] = {
 };
 
 /** rct2: 0x009ABF0C */
-uint8_t gOtherPalette[256] = {
+thread_local uint8_t gOtherPalette[256] = {
     0x00, 0xF3, 0xF4, 0xF5, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
     0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
     0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
@@ -469,23 +469,35 @@ void (*mask_fn)(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap)
     = nullptr;
+void (*blit_copy_nonzero_fn)(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count) = nullptr;
+void (*blit_copy_zoomed_fn)(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, int32_t zoomLevel) = nullptr;
+void (*blit_fill_pattern_fn)(uint8_t* dst, int32_t count, uint8_t colour, uint16_t pattern) = nullptr;
 
 void mask_init()
 {
     if (avx2_available())
     {
-        log_verbose("registering AVX2 mask function");
+        log_verbose("registering AVX2 mask and blit functions");
         mask_fn = mask_avx2;
+        blit_copy_nonzero_fn = blit_copy_nonzero_avx2;
+        blit_copy_zoomed_fn = blit_copy_zoomed_avx2;
+        blit_fill_pattern_fn = blit_fill_pattern_avx2;
     }
     else if (sse41_available())
     {
-        log_verbose("registering SSE4.1 mask function");
+        log_verbose("registering SSE4.1 mask and blit functions");
         mask_fn = mask_sse4_1;
+        blit_copy_nonzero_fn = blit_copy_nonzero_sse4_1;
+        blit_copy_zoomed_fn = blit_copy_zoomed_sse4_1;
+        blit_fill_pattern_fn = blit_fill_pattern_sse4_1;
     }
     else
     {
-        log_verbose("registering scalar mask function");
+        log_verbose("registering scalar mask and blit functions");
         mask_fn = mask_scalar;
+        blit_copy_nonzero_fn = blit_copy_nonzero_scalar;
+        blit_copy_zoomed_fn = blit_copy_zoomed_scalar;
+        blit_fill_pattern_fn = blit_fill_pattern_scalar;
     }
 }
 
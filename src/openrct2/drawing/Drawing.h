@@ -16,7 +16,12 @@
 namespace OpenRCT2
 {
     interface IPlatformEnvironment;
-}
+
+    namespace Drawing
+    {
+        class SpriteCache;
+    }
+} // namespace OpenRCT2
 
 struct rct_g1_element
 {
@@ -245,8 +250,9 @@ extern uint8_t gGamePalette[256 * 4];
 extern uint32_t gPaletteEffectFrame;
 extern const FILTER_PALETTE_ID GlassPaletteIds[COLOUR_COUNT];
 extern const uint16_t palette_to_g1_offset[];
-extern uint8_t gPeepPalette[256];
-extern uint8_t gOtherPalette[256];
+// Remap palettes are filled in per sprite, so each drawing thread has its own
+extern thread_local uint8_t gPeepPalette[256];
+extern thread_local uint8_t gOtherPalette[256];
 extern uint8_t text_palette[];
 extern const translucent_window_palette TranslucentWindowPalettes[COLOUR_COUNT];
 
@@ -315,11 +321,13 @@ void FASTCALL gfx_draw_glpyh(rct_drawpixelinfo* dpi, int32_t image_id, int32_t x
 void FASTCALL gfx_draw_sprite_raw_masked(rct_drawpixelinfo* dpi, int32_t x, int32_t y, int32_t maskImage, int32_t colourImage);
 void FASTCALL gfx_draw_sprite_solid(rct_drawpixelinfo* dpi, int32_t image, int32_t x, int32_t y, uint8_t colour);
 
-void FASTCALL
-    gfx_draw_sprite_software(rct_drawpixelinfo* dpi, int32_t image_id, int32_t x, int32_t y, uint32_t tertiary_colour);
+void FASTCALL gfx_draw_sprite_software(
+    rct_drawpixelinfo* dpi, int32_t image_id, int32_t x, int32_t y, uint32_t tertiary_colour,
+    OpenRCT2::Drawing::SpriteCache* spriteCache = nullptr);
 uint8_t* FASTCALL gfx_draw_sprite_get_palette(int32_t image_id, uint32_t tertiary_colour);
 void FASTCALL gfx_draw_sprite_palette_set_software(
-    rct_drawpixelinfo* dpi, int32_t image_id, int32_t x, int32_t y, uint8_t* palette_pointer, uint8_t* unknown_pointer);
+    rct_drawpixelinfo* dpi, int32_t image_id, int32_t x, int32_t y, uint8_t* palette_pointer, uint8_t* unknown_pointer,
+    OpenRCT2::Drawing::SpriteCache* spriteCache = nullptr);
 void FASTCALL
     gfx_draw_sprite_raw_masked_software(rct_drawpixelinfo* dpi, int32_t x, int32_t y, int32_t maskImage, int32_t colourImage);
 
@@ -388,6 +396,25 @@ extern void (*mask_fn)(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+// Copies count pixels, skipping the transparent (zero) ones
+void blit_copy_nonzero_scalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count);
+void blit_copy_nonzero_sse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count);
+void blit_copy_nonzero_avx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count);
+
+// Copies every (1 << zoomLevel)th source pixel into count destination pixels
+void blit_copy_zoomed_scalar(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, int32_t zoomLevel);
+void blit_copy_zoomed_sse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, int32_t zoomLevel);
+void blit_copy_zoomed_avx2(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, int32_t zoomLevel);
+
+// Sets each of the count pixels to colour if bit (i % 16) of pattern is set
+void blit_fill_pattern_scalar(uint8_t* dst, int32_t count, uint8_t colour, uint16_t pattern);
+void blit_fill_pattern_sse4_1(uint8_t* dst, int32_t count, uint8_t colour, uint16_t pattern);
+void blit_fill_pattern_avx2(uint8_t* dst, int32_t count, uint8_t colour, uint16_t pattern);
+
+extern void (*blit_copy_nonzero_fn)(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count);
+extern void (*blit_copy_zoomed_fn)(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, int32_t zoomLevel);
+extern void (*blit_fill_pattern_fn)(uint8_t* dst, int32_t count, uint8_t colour, uint16_t pattern);
+
 #include "NewDrawing.h"
 
 #endif
@@ -127,10 +127,9 @@ static void FASTCALL DrawRLESprite2(
                     if (numPixels > 0)
                         memcpy(copyDest, copySrc, numPixels);
                 }
-                else
+                else if (numPixels > 0)
                 {
-                    for (int j = 0; j < numPixels; j += zoom_amount, copySrc += zoom_amount, copyDest++)
-                        *copyDest = *copySrc;
+                    blit_copy_zoomed_fn(copySrc, copyDest, (numPixels + zoom_amount - 1) >> zoom_level, zoom_level);
                 }
             }
         }
@@ -24,13 +24,20 @@ namespace OpenRCT2::Drawing
 
         virtual OpenRCT2::Drawing::IDrawingEngine* GetEngine() abstract;
 
-        virtual void Clear(uint8_t paletteIndex) abstract;
-        virtual void FillRect(uint32_t colour, int32_t left, int32_t top, int32_t right, int32_t bottom) abstract;
-        virtual void FilterRect(FILTER_PALETTE_ID palette, int32_t left, int32_t top, int32_t right, int32_t bottom) abstract;
-        virtual void DrawLine(uint32_t colour, int32_t x1, int32_t y1, int32_t x2, int32_t y2) abstract;
-        virtual void DrawSprite(uint32_t image, int32_t x, int32_t y, uint32_t tertiaryColour) abstract;
-        virtual void DrawSpriteRawMasked(int32_t x, int32_t y, uint32_t maskImage, uint32_t colourImage) abstract;
-        virtual void DrawSpriteSolid(uint32_t image, int32_t x, int32_t y, uint8_t colour) abstract;
-        virtual void DrawGlyph(uint32_t image, int32_t x, int32_t y, uint8_t * palette) abstract;
+        // The target is passed with every call so that one context can be drawn with from several threads at once
+        virtual void Clear(rct_drawpixelinfo * dpi, uint8_t paletteIndex) abstract;
+        virtual void FillRect(
+            rct_drawpixelinfo * dpi, uint32_t colour, int32_t left, int32_t top, int32_t right, int32_t bottom) abstract;
+        virtual void FilterRect(
+            rct_drawpixelinfo * dpi, FILTER_PALETTE_ID palette, int32_t left, int32_t top, int32_t right,
+            int32_t bottom) abstract;
+        virtual void DrawLine(
+            rct_drawpixelinfo * dpi, uint32_t colour, int32_t x1, int32_t y1, int32_t x2, int32_t y2) abstract;
+        virtual void DrawSprite(
+            rct_drawpixelinfo * dpi, uint32_t image, int32_t x, int32_t y, uint32_t tertiaryColour) abstract;
+        virtual void DrawSpriteRawMasked(
+            rct_drawpixelinfo * dpi, int32_t x, int32_t y, uint32_t maskImage, uint32_t colourImage) abstract;
+        virtual void DrawSpriteSolid(rct_drawpixelinfo * dpi, uint32_t image, int32_t x, int32_t y, uint8_t colour) abstract;
+        virtual void DrawGlyph(rct_drawpixelinfo * dpi, uint32_t image, int32_t x, int32_t y, uint8_t * palette) abstract;
     };
 } // namespace OpenRCT2::Drawing
@@ -137,6 +137,17 @@ bool drawing_engine_has_dirty_optimisations()
     return result;
 }
 
+bool drawing_engine_has_parallel_drawing()
+{
+    bool result = false;
+    auto drawingEngine = GetDrawingEngine();
+    if (drawingEngine != nullptr)
+    {
+        result = (drawingEngine->GetFlags() & DEF_PARALLEL_DRAWING);
+    }
+    return result;
+}
+
 void drawing_engine_invalidate_image(uint32_t image)
 {
     auto drawingEngine = GetDrawingEngine();
@@ -174,7 +185,7 @@ void gfx_clear(rct_drawpixelinfo* dpi, uint8_t paletteIndex)
     if (drawingEngine != nullptr)
     {
         IDrawingContext* dc = drawingEngine->GetDrawingContext(dpi);
-        dc->Clear(paletteIndex);
+        dc->Clear(dpi, paletteIndex);
     }
 }
 
@@ -184,7 +195,7 @@ void gfx_fill_rect(rct_drawpixelinfo* dpi, int32_t left, int32_t top, int32_t ri
     if (drawingEngine != nullptr)
     {
         IDrawingContext* dc = drawingEngine->GetDrawingContext(dpi);
-        dc->FillRect(colour, left, top, right, bottom);
+        dc->FillRect(dpi, colour, left, top, right, bottom);
     }
 }
 
@@ -195,7 +206,7 @@ void gfx_filter_rect(
     if (drawingEngine != nullptr)
     {
         IDrawingContext* dc = drawingEngine->GetDrawingContext(dpi);
-        dc->FilterRect(palette, left, top, right, bottom);
+        dc->FilterRect(dpi, palette, left, top, right, bottom);
     }
 }
 
@@ -205,7 +216,7 @@ void gfx_draw_line(rct_drawpixelinfo* dpi, int32_t x1, int32_t y1, int32_t x2, i
     if (drawingEngine != nullptr)
     {
         IDrawingContext* dc = drawingEngine->GetDrawingContext(dpi);
-        dc->DrawLine(colour, x1, y1, x2, y2);
+        dc->DrawLine(dpi, colour, x1, y1, x2, y2);
     }
 }
 
@@ -215,7 +226,7 @@ void FASTCALL gfx_draw_sprite(rct_drawpixelinfo* dpi, int32_t image, int32_t x,
     if (drawingEngine != nullptr)
     {
         IDrawingContext* dc = drawingEngine->GetDrawingContext(dpi);
-        dc->DrawSprite(image, x, y, tertiary_colour);
+        dc->DrawSprite(dpi, image, x, y, tertiary_colour);
     }
 }
 
@@ -225,7 +236,7 @@ void FASTCALL gfx_draw_glpyh(rct_drawpixelinfo* dpi, int32_t image, int32_t x, i
     if (drawingEngine != nullptr)
     {
         IDrawingContext* dc = drawingEngine->GetDrawingContext(dpi);
-        dc->DrawGlyph(image, x, y, palette);
+        dc->DrawGlyph(dpi, image, x, y, palette);
     }
 }
 
@@ -235,7 +246,7 @@ void FASTCALL gfx_draw_sprite_raw_masked(rct_drawpixelinfo* dpi, int32_t x, int3
     if (drawingEngine != nullptr)
     {
         IDrawingContext* dc = drawingEngine->GetDrawingContext(dpi);
-        dc->DrawSpriteRawMasked(x, y, maskImage, colourImage);
+        dc->DrawSpriteRawMasked(dpi, x, y, maskImage, colourImage);
     }
 }
 
@@ -245,7 +256,7 @@ void FASTCALL gfx_draw_sprite_solid(rct_drawpixelinfo* dpi, int32_t image, int32
     if (drawingEngine != nullptr)
     {
         IDrawingContext* dc = drawingEngine->GetDrawingContext(dpi);
-        dc->DrawSpriteSolid(image, x, y, colour);
+        dc->DrawSpriteSolid(dpi, image, x, y, colour);
     }
 }
 
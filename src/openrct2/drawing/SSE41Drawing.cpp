@@ -56,6 +56,73 @@ void mask_sse4_1(
     }
 }
 
+void blit_copy_nonzero_sse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count)
+{
+    const __m128i zero128 = {};
+    int32_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i pixels = _mm_loadu_si128((const __m128i*)(src + i));
+        const __m128i dest = _mm_loadu_si128((const __m128i*)(dst + i));
+        const __m128i transparent = _mm_cmpeq_epi8(pixels, zero128);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_blendv_epi8(pixels, dest, transparent));
+    }
+    blit_copy_nonzero_scalar(src + i, dst + i, count - i);
+}
+
+void blit_copy_zoomed_sse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, int32_t zoomLevel)
+{
+    // Unzoomed copies are left to the scalar version's memcpy. The loops stop one vector early so that the loads
+    // never read past the last sampled source pixel
+    int32_t i = 0;
+    if (zoomLevel == 1)
+    {
+        // Keep the low byte of every pair of pixels, then pack the words back down to bytes
+        const __m128i lowBytes = _mm_set1_epi16(0x00FF);
+        for (; i + 16 < count; i += 16)
+        {
+            const uint8_t* s = src + (i << 1);
+            const __m128i a = _mm_and_si128(_mm_loadu_si128((const __m128i*)s), lowBytes);
+            const __m128i b = _mm_and_si128(_mm_loadu_si128((const __m128i*)(s + 16)), lowBytes);
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(a, b));
+        }
+    }
+    else if (zoomLevel == 2)
+    {
+        const __m128i lowBytes = _mm_set1_epi32(0xFF);
+        for (; i + 16 < count; i += 16)
+        {
+            const uint8_t* s = src + (i << 2);
+            const __m128i a = _mm_and_si128(_mm_loadu_si128((const __m128i*)s), lowBytes);
+            const __m128i b = _mm_and_si128(_mm_loadu_si128((const __m128i*)(s + 16)), lowBytes);
+            const __m128i c = _mm_and_si128(_mm_loadu_si128((const __m128i*)(s + 32)), lowBytes);
+            const __m128i d = _mm_and_si128(_mm_loadu_si128((const __m128i*)(s + 48)), lowBytes);
+            // _mm_packus_epi32 is SSE4.1
+            const __m128i ab = _mm_packus_epi32(a, b);
+            const __m128i cd = _mm_packus_epi32(c, d);
+            _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(ab, cd));
+        }
+    }
+    blit_copy_zoomed_scalar(src + (i << zoomLevel), dst + i, count - i, zoomLevel);
+}
+
+void blit_fill_pattern_sse4_1(uint8_t* dst, int32_t count, uint8_t colour, uint16_t pattern)
+{
+    // Spread the 16 pattern bits over 16 bytes, the pattern repeats every 16 pixels so one mask covers every vector
+    const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i spread = _mm_shuffle_epi8(
+        _mm_cvtsi32_si128(pattern), _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1));
+    const __m128i mask = _mm_cmpeq_epi8(_mm_and_si128(spread, bits), bits);
+    const __m128i fill = _mm_set1_epi8((char)colour);
+    int32_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i dest = _mm_loadu_si128((const __m128i*)(dst + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_blendv_epi8(dest, fill, mask));
+    }
+    blit_fill_pattern_scalar(dst + i, count - i, colour, pattern);
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -69,4 +136,19 @@ void mask_sse4_1(
     openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
 }
 
+void blit_copy_nonzero_sse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void blit_copy_zoomed_sse4_1(const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, int32_t count, int32_t zoomLevel)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
+void blit_fill_pattern_sse4_1(uint8_t* dst, int32_t count, uint8_t colour, uint16_t pattern)
+{
+    openrct2_assert(false, "SSE 4.1 function called on a CPU that doesn't support SSE 4.1");
+}
+
 #endif // __SSE4_1__
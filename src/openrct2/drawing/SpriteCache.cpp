@@ -0,0 +1,199 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "SpriteCache.h"
+
+#include "Drawing.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+using namespace OpenRCT2::Drawing;
+
+// Rough cost of the bookkeeping for each cached sprite, so that tiny sprites still count towards the budget
+static constexpr size_t ENTRY_OVERHEAD = 128;
+
+static size_t GetEntrySize(const PrescaledSprite& sprite)
+{
+    return sprite.Data.size() + ENTRY_OVERHEAD;
+}
+
+SpriteCache::SpriteCache(size_t budget)
+{
+    SetBudget(budget);
+}
+
+void SpriteCache::SetBudget(size_t budget)
+{
+    _shardBudget = budget / SHARD_COUNT;
+    for (auto& shard : _shards)
+    {
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        Evict(shard, _shardBudget);
+    }
+}
+
+std::shared_ptr<const PrescaledSprite> SpriteCache::GetPrescaled(
+    uint32_t imageIndex, const rct_g1_element* g1, int32_t zoomLevel, int32_t phaseX, int32_t phaseY)
+{
+    if (_shardBudget == 0)
+    {
+        return nullptr;
+    }
+
+    auto key = GetKey(imageIndex, zoomLevel, phaseX, phaseY);
+    auto& shard = GetShard(imageIndex);
+    {
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        auto it = shard.Entries.find(key);
+        if (it != shard.Entries.end())
+        {
+            auto& entry = it->second;
+            // Images that are replaced without being invalidated will have moved
+            if (entry.Sprite->Source == g1->offset)
+            {
+                shard.Lru.splice(shard.Lru.begin(), shard.Lru, entry.LruPosition);
+                return entry.Sprite;
+            }
+            shard.Size -= GetEntrySize(*entry.Sprite);
+            shard.Lru.erase(entry.LruPosition);
+            shard.Entries.erase(it);
+        }
+    }
+
+    // Build outside of the lock, another thread drawing the same sprite just builds its own copy
+    std::shared_ptr<const PrescaledSprite> sprite = PrescaleRLESprite(g1, zoomLevel, phaseX, phaseY);
+
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    if (shard.Entries.find(key) == shard.Entries.end())
+    {
+        shard.Lru.push_front(key);
+        shard.Entries[key] = { sprite, shard.Lru.begin() };
+        shard.Size += GetEntrySize(*sprite);
+        Evict(shard, _shardBudget);
+    }
+    return sprite;
+}
+
+void SpriteCache::Invalidate(uint32_t imageIndex)
+{
+    auto& shard = GetShard(imageIndex);
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    auto begin = shard.Entries.lower_bound(GetKey(imageIndex, 0, 0, 0));
+    auto end = shard.Entries.lower_bound(GetKey(imageIndex + 1, 0, 0, 0));
+    for (auto it = begin; it != end; it++)
+    {
+        shard.Size -= GetEntrySize(*it->second.Sprite);
+        shard.Lru.erase(it->second.LruPosition);
+    }
+    shard.Entries.erase(begin, end);
+}
+
+void SpriteCache::Clear()
+{
+    for (auto& shard : _shards)
+    {
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        shard.Entries.clear();
+        shard.Lru.clear();
+        shard.Size = 0;
+    }
+}
+
+SpriteCache::Key SpriteCache::GetKey(uint32_t imageIndex, int32_t zoomLevel, int32_t phaseX, int32_t phaseY)
+{
+    // Zoom levels go up to 3, so each phase fits in 3 bits
+    return (imageIndex << 8) | (zoomLevel << 6) | (phaseX << 3) | phaseY;
+}
+
+SpriteCache::Shard& SpriteCache::GetShard(uint32_t imageIndex)
+{
+    return _shards[imageIndex % SHARD_COUNT];
+}
+
+void SpriteCache::Evict(Shard& shard, size_t budget)
+{
+    while (shard.Size > budget && !shard.Lru.empty())
+    {
+        auto it = shard.Entries.find(shard.Lru.back());
+        shard.Size -= GetEntrySize(*it->second.Sprite);
+        shard.Entries.erase(it);
+        shard.Lru.pop_back();
+    }
+}
+
+/**
+ * Keeps the pixels at (phaseX + i * zoom, phaseY + j * zoom) of an RLE sprite. These are exactly the pixels a zoomed
+ * draw samples when its source start is in the same phase.
+ */
+std::shared_ptr<PrescaledSprite> OpenRCT2::Drawing::PrescaleRLESprite(
+    const rct_g1_element* g1, int32_t zoomLevel, int32_t phaseX, int32_t phaseY)
+{
+    int32_t zoomAmount = 1 << zoomLevel;
+    int32_t rows = std::max(0, (g1->height - phaseY + zoomAmount - 1) >> zoomLevel);
+
+    auto sprite = std::make_shared<PrescaledSprite>();
+    sprite->Source = g1->offset;
+    auto& data = sprite->Data;
+    data.resize(rows * sizeof(uint16_t));
+
+    for (int32_t row = 0; row < rows; row++)
+    {
+        uint16_t rowOffset = (uint16_t)data.size();
+        std::memcpy(&data[row * sizeof(uint16_t)], &rowOffset, sizeof(uint16_t));
+
+        int32_t y = phaseY + (row << zoomLevel);
+        const uint8_t* lineData = g1->offset + ((const uint16_t*)g1->offset)[y];
+        size_t lastChunk = SIZE_MAX;
+        bool isEndOfLine = false;
+        while (!isEndOfLine)
+        {
+            uint8_t dataSize = *lineData++;
+            uint8_t firstPixelX = *lineData++;
+            isEndOfLine = (dataSize & 0x80) != 0;
+            dataSize &= 0x7F;
+            const uint8_t* pixels = lineData;
+            lineData += dataSize;
+
+            // Find the first and last sampled columns that fall within the run
+            int32_t runStart = firstPixelX;
+            int32_t runEnd = firstPixelX + dataSize - 1;
+            if (dataSize == 0 || runEnd < phaseX)
+            {
+                continue;
+            }
+            int32_t firstColumn = runStart <= phaseX ? 0 : (runStart - phaseX + zoomAmount - 1) >> zoomLevel;
+            int32_t lastColumn = (runEnd - phaseX) >> zoomLevel;
+            if (lastColumn < firstColumn)
+            {
+                continue;
+            }
+
+            lastChunk = data.size();
+            data.push_back((uint8_t)(lastColumn - firstColumn + 1));
+            data.push_back((uint8_t)firstColumn);
+            for (int32_t column = firstColumn; column <= lastColumn; column++)
+            {
+                data.push_back(pixels[phaseX + (column << zoomLevel) - runStart]);
+            }
+        }
+
+        if (lastChunk == SIZE_MAX)
+        {
+            // Every line needs at least one run to mark its end
+            lastChunk = data.size();
+            data.push_back(0);
+            data.push_back(0);
+        }
+        data[lastChunk] |= 0x80;
+    }
+    data.shrink_to_fit();
+    return sprite;
+}
@@ -0,0 +1,91 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+struct rct_g1_element;
+
+namespace OpenRCT2::Drawing
+{
+    /**
+     * An RLE sprite reduced to the pixels that are sampled when drawing it zoomed out. It uses the same format as the
+     * RLE g1 elements, so it can be drawn unzoomed with plain copies of each run.
+     */
+    struct PrescaledSprite
+    {
+        const uint8_t* Source = nullptr;
+        std::vector<uint8_t> Data;
+    };
+
+    /**
+     * Keeps the most recently drawn prescaled sprites within a memory budget. Sprites are keyed by image, zoom level
+     * and the phase of the sampling grid, as clipping changes which source pixels a zoomed draw lands on. Safe to use
+     * from several drawing threads at once.
+     */
+    class SpriteCache final
+    {
+    private:
+        static constexpr size_t SHARD_COUNT = 16;
+
+        using Key = uint32_t;
+        struct Entry
+        {
+            std::shared_ptr<const PrescaledSprite> Sprite;
+            std::list<Key>::iterator LruPosition;
+        };
+
+        // Every variant of an image is kept in the same shard so that it can be invalidated in one go
+        struct Shard
+        {
+            std::mutex Mutex;
+            std::map<Key, Entry> Entries;
+            std::list<Key> Lru;
+            size_t Size = 0;
+        };
+
+        Shard _shards[SHARD_COUNT];
+        std::atomic<size_t> _shardBudget = { 0 };
+
+    public:
+        explicit SpriteCache(size_t budget = 0);
+
+        size_t GetBudget() const
+        {
+            return _shardBudget * SHARD_COUNT;
+        }
+        void SetBudget(size_t budget);
+
+        /**
+         * Gets the given RLE image prescaled for the zoom level, building it if it is not cached. Returns nullptr if
+         * the cache is disabled.
+         */
+        std::shared_ptr<const PrescaledSprite> GetPrescaled(
+            uint32_t imageIndex, const rct_g1_element* g1, int32_t zoomLevel, int32_t phaseX, int32_t phaseY);
+
+        void Invalidate(uint32_t imageIndex);
+        void Clear();
+
+    private:
+        static Key GetKey(uint32_t imageIndex, int32_t zoomLevel, int32_t phaseX, int32_t phaseY);
+        Shard& GetShard(uint32_t imageIndex);
+        void Evict(Shard& shard, size_t budget);
+    };
+
+    std::shared_ptr<PrescaledSprite> PrescaleRLESprite(
+        const rct_g1_element* g1, int32_t zoomLevel, int32_t phaseX, int32_t phaseY);
+} // namespace OpenRCT2::Drawing
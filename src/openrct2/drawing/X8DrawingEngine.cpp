@@ -13,6 +13,7 @@
 #include "../Game.h"
 #include "../Intro.h"
 #include "../config/Config.h"
+#include "../core/Profiler.hpp"
 #include "../interface/Screenshot.h"
 #include "../interface/Viewport.h"
 #include "../interface/Window.h"
@@ -197,6 +198,12 @@ void X8DrawingEngine::Invalidate(int32_t left, int32_t top, int32_t right, int32
 
 void X8DrawingEngine::BeginDraw()
 {
+    size_t spriteCacheBudget = (size_t)std::max(0, gConfigGeneral.sprite_cache_size) * 1024 * 1024;
+    if (_spriteCache.GetBudget() != spriteCacheBudget)
+    {
+        _spriteCache.SetBudget(spriteCacheBudget);
+    }
+
     if (gIntroState == INTRO_STATE_NONE)
     {
 #ifdef __ENABLE_LIGHTFX__
@@ -279,9 +286,8 @@ int32_t X8DrawingEngine::Screenshot()
     return screenshot_dump_png(&_bitsDPI);
 }
 
-IDrawingContext* X8DrawingEngine::GetDrawingContext(rct_drawpixelinfo* dpi)
+IDrawingContext* X8DrawingEngine::GetDrawingContext([[maybe_unused]] rct_drawpixelinfo* dpi)
 {
-    _drawingContext->SetDPI(dpi);
     return _drawingContext;
 }
 
@@ -292,12 +298,12 @@ rct_drawpixelinfo* X8DrawingEngine::GetDrawingPixelInfo()
 
 DRAWING_ENGINE_FLAGS X8DrawingEngine::GetFlags()
 {
-    return DEF_DIRTY_OPTIMISATIONS;
+    return (DRAWING_ENGINE_FLAGS)(DEF_DIRTY_OPTIMISATIONS | DEF_PARALLEL_DRAWING);
 }
 
-void X8DrawingEngine::InvalidateImage([[maybe_unused]] uint32_t image)
+void X8DrawingEngine::InvalidateImage(uint32_t image)
 {
-    // Not applicable for this engine
+    _spriteCache.Invalidate(image);
 }
 
 rct_drawpixelinfo* X8DrawingEngine::GetDPI()
@@ -305,6 +311,11 @@ rct_drawpixelinfo* X8DrawingEngine::GetDPI()
     return &_bitsDPI;
 }
 
+SpriteCache& X8DrawingEngine::GetSpriteCache()
+{
+    return _spriteCache;
+}
+
 void X8DrawingEngine::ConfigureBits(uint32_t width, uint32_t height, uint32_t pitch)
 {
     size_t newBitsSize = pitch * height;
@@ -384,6 +395,7 @@ void X8DrawingEngine::ConfigureDirtyGrid()
 
 void X8DrawingEngine::DrawAllDirtyBlocks()
 {
+    Profiler::ScopedTimer profilerScope("X8DrawingEngine::DrawAllDirtyBlocks");
     uint32_t dirtyBlockColumns = _dirtyGrid.BlockColumns;
     uint32_t dirtyBlockRows = _dirtyGrid.BlockRows;
     uint8_t* dirtyBlocks = _dirtyGrid.Blocks;
@@ -474,10 +486,8 @@ IDrawingEngine* X8DrawingContext::GetEngine()
     return _engine;
 }
 
-void X8DrawingContext::Clear(uint8_t paletteIndex)
+void X8DrawingContext::Clear(rct_drawpixelinfo* dpi, uint8_t paletteIndex)
 {
-    rct_drawpixelinfo* dpi = _dpi;
-
     int32_t w = dpi->width >> dpi->zoom_level;
     int32_t h = dpi->height >> dpi->zoom_level;
     uint8_t* ptr = dpi->bits;
@@ -537,10 +547,9 @@ static constexpr const uint16_t * Patterns[] = {
 };
 // clang-format on
 
-void X8DrawingContext::FillRect(uint32_t colour, int32_t left, int32_t top, int32_t right, int32_t bottom)
+void X8DrawingContext::FillRect(
+    rct_drawpixelinfo* dpi, uint32_t colour, int32_t left, int32_t top, int32_t right, int32_t bottom)
 {
-    rct_drawpixelinfo* dpi = _dpi;
-
     if (left > right)
         return;
     if (top > bottom)
@@ -591,22 +600,11 @@ void X8DrawingContext::FillRect(uint32_t colour, int32_t left, int32_t top, int3
         uint8_t* dst = (startY * (dpi->width + dpi->pitch)) + startX + dpi->bits;
         for (int32_t i = 0; i < height; i++)
         {
-            uint8_t* nextdst = dst + dpi->width + dpi->pitch;
-            uint32_t p = ror32(crossPattern, 1);
-            p = (p & 0xFFFF0000) | width;
-
-            // Fill every other pixel with the colour
-            for (; (p & 0xFFFF) != 0; p--)
-            {
-                p = p ^ 0x80000000;
-                if (p & 0x80000000)
-                {
-                    *dst = colour & 0xFF;
-                }
-                dst++;
-            }
+            // Fill every other pixel with the colour, starting with the first when the cross pattern is even
+            uint16_t pattern = (crossPattern & 1) ? 0xAAAA : 0x5555;
+            blit_fill_pattern_fn(dst, width, colour & 0xFF, pattern);
             crossPattern ^= 1;
-            dst = nextdst;
+            dst += dpi->width + dpi->pitch;
         }
     }
     else if (colour & 0x2000000)
@@ -624,27 +622,18 @@ void X8DrawingContext::FillRect(uint32_t colour, int32_t left, int32_t top, int3
         // The pattern loops every 15 pixels this is which
         // part the pattern is on.
         int32_t startPatternX = (startX + dpi->x) % 16;
-        int32_t patternX = startPatternX;
 
         const uint16_t* patternsrc = Patterns[colour >> 28]; // or possibly uint8_t)[esi*4] ?
 
         for (int32_t numLines = height; numLines > 0; numLines--)
         {
-            uint8_t* nextdst = dst + dpi->width + dpi->pitch;
+            // Rotate the pattern so that its first bit lines up with the first pixel
             uint16_t pattern = patternsrc[patternY];
+            pattern = (uint16_t)((pattern >> startPatternX) | (pattern << (16 - startPatternX)));
+            blit_fill_pattern_fn(dst, width, colour & 0xFF, pattern);
 
-            for (int32_t numPixels = width; numPixels > 0; numPixels--)
-            {
-                if (pattern & (1 << patternX))
-                {
-                    *dst = colour & 0xFF;
-                }
-                patternX = (patternX + 1) % 16;
-                dst++;
-            }
-            patternX = startPatternX;
             patternY = (patternY + 1) % 16;
-            dst = nextdst;
+            dst += dpi->width + dpi->pitch;
         }
     }
     else
@@ -658,10 +647,9 @@ void X8DrawingContext::FillRect(uint32_t colour, int32_t left, int32_t top, int3
     }
 }
 
-void X8DrawingContext::FilterRect(FILTER_PALETTE_ID palette, int32_t left, int32_t top, int32_t right, int32_t bottom)
+void X8DrawingContext::FilterRect(
+    rct_drawpixelinfo* dpi, FILTER_PALETTE_ID palette, int32_t left, int32_t top, int32_t right, int32_t bottom)
 {
-    rct_drawpixelinfo* dpi = _dpi;
-
     if (left > right)
         return;
     if (top > bottom)
@@ -730,37 +718,34 @@ void X8DrawingContext::FilterRect(FILTER_PALETTE_ID palette, int32_t left, int32
     }
 }
 
-void X8DrawingContext::DrawLine(uint32_t colour, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+void X8DrawingContext::DrawLine(rct_drawpixelinfo* dpi, uint32_t colour, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
 {
-    gfx_draw_line_software(_dpi, x1, y1, x2, y2, colour);
+    gfx_draw_line_software(dpi, x1, y1, x2, y2, colour);
 }
 
-void X8DrawingContext::DrawSprite(uint32_t image, int32_t x, int32_t y, uint32_t tertiaryColour)
+void X8DrawingContext::DrawSprite(rct_drawpixelinfo* dpi, uint32_t image, int32_t x, int32_t y, uint32_t tertiaryColour)
 {
-    gfx_draw_sprite_software(_dpi, image, x, y, tertiaryColour);
+    gfx_draw_sprite_software(dpi, image, x, y, tertiaryColour, &_engine->GetSpriteCache());
 }
 
-void X8DrawingContext::DrawSpriteRawMasked(int32_t x, int32_t y, uint32_t maskImage, uint32_t colourImage)
+void X8DrawingContext::DrawSpriteRawMasked(
+    rct_drawpixelinfo* dpi, int32_t x, int32_t y, uint32_t maskImage, uint32_t colourImage)
 {
-    gfx_draw_sprite_raw_masked_software(_dpi, x, y, maskImage, colourImage);
+    gfx_draw_sprite_raw_masked_software(dpi, x, y, maskImage, colourImage);
 }
 
-void X8DrawingContext::DrawSpriteSolid(uint32_t image, int32_t x, int32_t y, uint8_t colour)
+void X8DrawingContext::DrawSpriteSolid(rct_drawpixelinfo* dpi, uint32_t image, int32_t x, int32_t y, uint8_t colour)
 {
     uint8_t palette[256];
     memset(palette, colour, 256);
     palette[0] = 0;
 
     image &= 0x7FFFF;
-    gfx_draw_sprite_palette_set_software(_dpi, image | IMAGE_TYPE_REMAP, x, y, palette, nullptr);
-}
-
-void X8DrawingContext::DrawGlyph(uint32_t image, int32_t x, int32_t y, uint8_t* palette)
-{
-    gfx_draw_sprite_palette_set_software(_dpi, image, x, y, palette, nullptr);
+    gfx_draw_sprite_palette_set_software(
+        dpi, image | IMAGE_TYPE_REMAP, x, y, palette, nullptr, &_engine->GetSpriteCache());
 }
 
-void X8DrawingContext::SetDPI(rct_drawpixelinfo* dpi)
+void X8DrawingContext::DrawGlyph(rct_drawpixelinfo* dpi, uint32_t image, int32_t x, int32_t y, uint8_t* palette)
 {
-    _dpi = dpi;
+    gfx_draw_sprite_palette_set_software(dpi, image, x, y, palette, nullptr, &_engine->GetSpriteCache());
 }
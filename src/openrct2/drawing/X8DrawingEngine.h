@@ -12,6 +12,7 @@
 #include "../common.h"
 #include "IDrawingContext.h"
 #include "IDrawingEngine.h"
+#include "SpriteCache.h"
 
 namespace OpenRCT2
 {
@@ -82,6 +83,7 @@ namespace OpenRCT2
 
             X8RainDrawer _rainDrawer;
             X8DrawingContext* _drawingContext;
+            SpriteCache _spriteCache;
 
         public:
             explicit X8DrawingEngine(const std::shared_ptr<Ui::IUiContext>& uiContext);
@@ -104,6 +106,7 @@ namespace OpenRCT2
             void InvalidateImage(uint32_t image) override;
 
             rct_drawpixelinfo* GetDPI();
+            SpriteCache& GetSpriteCache();
 
         protected:
             void ConfigureBits(uint32_t width, uint32_t height, uint32_t pitch);
@@ -123,23 +126,23 @@ namespace OpenRCT2
         {
         private:
             X8DrawingEngine* _engine = nullptr;
-            rct_drawpixelinfo* _dpi = nullptr;
 
         public:
             explicit X8DrawingContext(X8DrawingEngine* engine);
 
             IDrawingEngine* GetEngine() override;
 
-            void Clear(uint8_t paletteIndex) override;
-            void FillRect(uint32_t colour, int32_t x, int32_t y, int32_t w, int32_t h) override;
-            void FilterRect(FILTER_PALETTE_ID palette, int32_t left, int32_t top, int32_t right, int32_t bottom) override;
-            void DrawLine(uint32_t colour, int32_t x1, int32_t y1, int32_t x2, int32_t y2) override;
-            void DrawSprite(uint32_t image, int32_t x, int32_t y, uint32_t tertiaryColour) override;
-            void DrawSpriteRawMasked(int32_t x, int32_t y, uint32_t maskImage, uint32_t colourImage) override;
-            void DrawSpriteSolid(uint32_t image, int32_t x, int32_t y, uint8_t colour) override;
-            void DrawGlyph(uint32_t image, int32_t x, int32_t y, uint8_t* palette) override;
-
-            void SetDPI(rct_drawpixelinfo* dpi);
+            void Clear(rct_drawpixelinfo* dpi, uint8_t paletteIndex) override;
+            void FillRect(rct_drawpixelinfo* dpi, uint32_t colour, int32_t x, int32_t y, int32_t w, int32_t h) override;
+            void FilterRect(
+                rct_drawpixelinfo* dpi, FILTER_PALETTE_ID palette, int32_t left, int32_t top, int32_t right,
+                int32_t bottom) override;
+            void DrawLine(rct_drawpixelinfo* dpi, uint32_t colour, int32_t x1, int32_t y1, int32_t x2, int32_t y2) override;
+            void DrawSprite(rct_drawpixelinfo* dpi, uint32_t image, int32_t x, int32_t y, uint32_t tertiaryColour) override;
+            void DrawSpriteRawMasked(
+                rct_drawpixelinfo* dpi, int32_t x, int32_t y, uint32_t maskImage, uint32_t colourImage) override;
+            void DrawSpriteSolid(rct_drawpixelinfo* dpi, uint32_t image, int32_t x, int32_t y, uint8_t colour) override;
+            void DrawGlyph(rct_drawpixelinfo* dpi, uint32_t image, int32_t x, int32_t y, uint8_t* palette) override;
         };
     } // namespace Drawing
 } // namespace OpenRCT2
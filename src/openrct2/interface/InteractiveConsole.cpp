@@ -16,6 +16,7 @@
 #include "../Version.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../core/Profiler.hpp"
 #include "../core/String.hpp"
 #include "../drawing/Drawing.h"
 #include "../drawing/Font.h"
@@ -1201,6 +1202,39 @@ static int32_t cc_show_limits(InteractiveConsole& console, [[maybe_unused]] cons
     return 0;
 }
 
+static int32_t cc_profiler(InteractiveConsole& console, const utf8** argv, int32_t argc)
+{
+    if (argc >= 1 && String::Equals(argv[0], "on"))
+    {
+        Profiler::SetEnabled(true);
+        return 0;
+    }
+    if (argc >= 1 && String::Equals(argv[0], "off"))
+    {
+        Profiler::SetEnabled(false);
+        return 0;
+    }
+    if (argc >= 2 && String::Equals(argv[0], "trace"))
+    {
+        Profiler::StartTrace(argv[1]);
+        console.WriteFormatLine("Recording trace to %s", argv[1]);
+        return 0;
+    }
+    if (argc >= 1 && String::Equals(argv[0], "stop"))
+    {
+        if (!Profiler::StopTrace())
+        {
+            console.WriteLineError("No trace was written.");
+            return 1;
+        }
+        console.WriteLine("Trace written.");
+        return 0;
+    }
+
+    console.WriteLineError("Usage: profiler on|off|trace <file>|stop");
+    return 1;
+}
+
 static int32_t cc_for_date(
     [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const utf8** argv, [[maybe_unused]] int32_t argc)
 {
@@ -1341,6 +1375,7 @@ static constexpr const console_command console_command_table[] = {
     { "remove_unused_objects", cc_remove_unused_objects, "Removes all the unused objects from the object selection.", "remove_unused_objects" },
     { "remove_park_fences", cc_remove_park_fences, "Removes all park fences from the surface", "remove_park_fences"},
     { "show_limits", cc_show_limits, "Shows the map data counts and limits.", "show_limits" },
+    { "profiler", cc_profiler, "Shows the stage timings overlay or records a Chrome trace of the stages.", "profiler on|off|trace <file>|stop" },
     { "date", cc_for_date, "Sets the date to a given date.", "Format <year>[ <month>[ <day>]]."}
 };
 // clang-format on
@@ -14,9 +14,13 @@
 #include "../Intro.h"
 #include "../OpenRCT2.h"
 #include "../audio/audio.h"
+#include "../config/Config.h"
 #include "../core/Console.hpp"
 #include "../core/Imaging.h"
+#include "../core/TaskScheduler.hpp"
 #include "../drawing/Drawing.h"
+#include "../drawing/LightFX.h"
+#include "../drawing/NewDrawing.h"
 #include "../localisation/Localisation.h"
 #include "../platform/platform.h"
 #include "../util/Util.h"
@@ -26,9 +30,11 @@
 #include "../world/Surface.h"
 #include "Viewport.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <memory>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -57,6 +63,95 @@ static bool WriteDpiToFile(const std::string_view& path, const rct_drawpixelinfo
     }
 }
 
+static constexpr int32_t SCREENSHOT_BAND_HEIGHT = 128;
+
+static void RenderViewportBand(rct_viewport* viewport, int32_t top, int32_t height, uint8_t* bits)
+{
+    rct_drawpixelinfo dpi;
+    dpi.x = 0;
+    dpi.y = top;
+    dpi.width = viewport->width;
+    dpi.height = height;
+    dpi.pitch = 0;
+    dpi.zoom_level = 0;
+    dpi.bits = bits;
+    viewport_render(&dpi, viewport, 0, top, viewport->width, top + height);
+}
+
+/**
+ * Renders the viewport in horizontal bands and streams the rows into a PNG, so only a few bands are held in memory at
+ * once. With multithreading enabled, each batch of bands is rendered in parallel while the previous batch is encoded.
+ */
+static bool WriteViewportToFile(const std::string_view& path, rct_viewport* viewport, const rct_palette& palette)
+{
+    // Bands are drawn through the drawing engine, which has to allow several threads drawing at once
+    bool useMultithreading = gConfigGeneral.multithreading && drawing_engine_has_parallel_drawing();
+#ifdef __ENABLE_LIGHTFX__
+    if (lightfx_is_available())
+    {
+        useMultithreading = false;
+    }
+#endif
+
+    const int32_t width = viewport->width;
+    const int32_t height = viewport->height;
+    const int32_t bandsPerBatch = useMultithreading ? (int32_t)TaskScheduler::GetConcurrency() * 2 : 1;
+    const int32_t batchHeight = SCREENSHOT_BAND_HEIGHT * bandsPerBatch;
+    const int32_t numBatches = (height + batchHeight - 1) / batchHeight;
+
+    // Declared before the task groups so that any bands still rendering finish before their buffers are freed
+    std::vector<uint8_t> buffers[2];
+    std::unique_ptr<TaskGroup> batchTasks[2];
+
+    auto startBatch = [&](int32_t batch) {
+        if (batch >= numBatches)
+        {
+            return;
+        }
+
+        auto& buffer = buffers[batch % 2];
+        buffer.resize((size_t)width * batchHeight);
+        auto tasks = std::make_unique<TaskGroup>();
+        int32_t batchTop = batch * batchHeight;
+        int32_t batchBottom = std::min(height, batchTop + batchHeight);
+        for (int32_t top = batchTop; top < batchBottom; top += SCREENSHOT_BAND_HEIGHT)
+        {
+            int32_t bandHeight = std::min(SCREENSHOT_BAND_HEIGHT, batchBottom - top);
+            uint8_t* bits = buffer.data() + (size_t)(top - batchTop) * width;
+            if (useMultithreading)
+            {
+                tasks->Run([viewport, top, bandHeight, bits]() { RenderViewportBand(viewport, top, bandHeight, bits); });
+            }
+            else
+            {
+                RenderViewportBand(viewport, top, bandHeight, bits);
+            }
+        }
+        batchTasks[batch % 2] = std::move(tasks);
+    };
+
+    try
+    {
+        startBatch(0);
+        Imaging::WriteRowsToFile(path, width, height, palette, [&](uint32_t y) -> const uint8_t* {
+            int32_t batch = y / batchHeight;
+            int32_t batchRow = y % batchHeight;
+            if (batchRow == 0)
+            {
+                batchTasks[batch % 2]->Wait();
+                startBatch(batch + 1);
+            }
+            return buffers[batch % 2].data() + (size_t)batchRow * width;
+        });
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to write png: %s", e.what());
+        return false;
+    }
+}
+
 /**
  *
  *  rct2: 0x006E3AEC
@@ -288,17 +383,6 @@ void screenshot_giant()
     // Ensure sprites appear regardless of rotation
     reset_all_sprite_quadrant_placements();
 
-    rct_drawpixelinfo dpi;
-    dpi.x = 0;
-    dpi.y = 0;
-    dpi.width = resolutionWidth;
-    dpi.height = resolutionHeight;
-    dpi.pitch = 0;
-    dpi.zoom_level = 0;
-    dpi.bits = (uint8_t*)malloc(dpi.width * dpi.height);
-
-    viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height);
-
     // Get a free screenshot path
     char path[MAX_PATH];
     if (screenshot_get_next_path(path, MAX_PATH) == -1)
@@ -311,9 +395,7 @@ void screenshot_giant()
     rct_palette renderedPalette;
     screenshot_get_rendered_palette(&renderedPalette);
 
-    WriteDpiToFile(path, &dpi, renderedPalette);
-
-    free(dpi.bits);
+    WriteViewportToFile(path, &viewport, renderedPalette);
 
     // Show user that screenshot saved successfully
     set_format_arg(0, rct_string_id, STR_STRING);
@@ -585,15 +667,6 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
         // Ensure sprites appear regardless of rotation
         reset_all_sprite_quadrant_placements();
 
-        rct_drawpixelinfo dpi;
-        dpi.x = 0;
-        dpi.y = 0;
-        dpi.width = resolutionWidth;
-        dpi.height = resolutionHeight;
-        dpi.pitch = 0;
-        dpi.zoom_level = 0;
-        dpi.bits = (uint8_t*)malloc(dpi.width * dpi.height);
-
         if (options->hide_guests)
         {
             viewport.flags |= VIEWPORT_FLAG_INVISIBLE_PEEPS;
@@ -629,14 +702,11 @@ int32_t cmdline_for_screenshot(const char** argv, int32_t argc, ScreenshotOption
             game_do_command(0, GAME_COMMAND_FLAG_APPLY, CHEAT_REMOVELITTER, 0, GAME_COMMAND_CHEAT, 0, 0);
         }
 
-        viewport_render(&dpi, &viewport, 0, 0, viewport.width, viewport.height);
-
         rct_palette renderedPalette;
         screenshot_get_rendered_palette(&renderedPalette);
 
-        WriteDpiToFile(outputPath, &dpi, renderedPalette);
+        WriteViewportToFile(outputPath, &viewport, renderedPalette);
 
-        free(dpi.bits);
         drawing_engine_dispose();
     }
     return 1;
@@ -14,7 +14,10 @@
 #include "../Input.h"
 #include "../OpenRCT2.h"
 #include "../config/Config.h"
+#include "../core/Profiler.hpp"
+#include "../core/TaskScheduler.hpp"
 #include "../drawing/Drawing.h"
+#include "../drawing/LightFX.h"
 #include "../paint/Paint.h"
 #include "../peep/Staff.h"
 #include "../ride/Ride.h"
@@ -30,6 +33,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -61,7 +65,14 @@ static int16_t _interactionMapX;
 static int16_t _interactionMapY;
 static uint16_t _unk9AC154;
 
-static void viewport_paint_column(rct_drawpixelinfo* dpi, uint32_t viewFlags);
+struct viewport_paint_column_state
+{
+    rct_drawpixelinfo DPI;
+    paint_session* Session;
+};
+
+static void viewport_fill_column(viewport_paint_column_state* column, uint32_t viewFlags);
+static void viewport_paint_column(viewport_paint_column_state* column, uint32_t viewFlags);
 static void viewport_paint_weather_gloom(rct_drawpixelinfo* dpi);
 
 /**
@@ -845,6 +856,7 @@ void viewport_render(rct_drawpixelinfo* dpi, rct_viewport* viewport, int32_t lef
  */
 void viewport_paint(rct_viewport* viewport, rct_drawpixelinfo* dpi, int16_t left, int16_t top, int16_t right, int16_t bottom)
 {
+    Profiler::ScopedTimer profilerScope("viewport_paint");
     uint32_t viewFlags = viewport->flags;
     uint16_t width = right - left;
     uint16_t height = bottom - top;
@@ -878,7 +890,9 @@ void viewport_paint(rct_viewport* viewport, rct_drawpixelinfo* dpi, int16_t left
     // this as well as the [x += 32] in the loop causes signed integer overflow -> undefined behaviour.
     int16_t rightBorder = dpi1.x + dpi1.width;
 
-    // Splits the area into 32 pixel columns and renders them
+    // Splits the area into 32 pixel columns
+    std::vector<viewport_paint_column_state> columns;
+    columns.reserve(((rightBorder - floor2(dpi1.x, 32)) / 32) + 1);
     for (x = floor2(dpi1.x, 32); x < rightBorder; x += 32)
     {
         rct_drawpixelinfo dpi2 = dpi1;
@@ -900,14 +914,55 @@ void viewport_paint(rct_viewport* viewport, rct_drawpixelinfo* dpi, int16_t left
         }
         dpi2.width = paintRight - dpi2.x;
 
-        viewport_paint_column(&dpi2, viewFlags);
+        columns.push_back({ dpi2, nullptr });
     }
-}
 
-static void viewport_paint_column(rct_drawpixelinfo* dpi, uint32_t viewFlags)
-{
     gCurrentViewportFlags = viewFlags;
+    for (auto& column : columns)
+    {
+        column.Session = paint_session_alloc(&column.DPI);
+    }
+
+    // Columns do not overlap, so each one can be generated, arranged and drawn independently.
+    bool useMultithreading = gConfigGeneral.multithreading && columns.size() > 1 && drawing_engine_has_parallel_drawing();
+#ifdef __ENABLE_LIGHTFX__
+    // Light effects collect their lights into shared state while painting.
+    if (lightfx_is_available())
+    {
+        useMultithreading = false;
+    }
+#endif
+    if (useMultithreading)
+    {
+        TaskGroup paintTasks;
+        for (auto& column : columns)
+        {
+            auto columnPtr = &column;
+            paintTasks.Run([columnPtr, viewFlags]() { viewport_fill_column(columnPtr, viewFlags); });
+        }
+        paintTasks.Wait();
+    }
+    else
+    {
+        for (auto& column : columns)
+        {
+            viewport_fill_column(&column, viewFlags);
+        }
+    }
 
+    // Weather gloom and money effects use the shared text drawing state, so they are always drawn
+    // on the calling thread once all the columns are done.
+    std::lock_guard<std::mutex> textLock(gPaintTextMutex);
+    for (auto& column : columns)
+    {
+        viewport_paint_column(&column, viewFlags);
+        paint_session_free(column.Session);
+    }
+}
+
+static void viewport_fill_column(viewport_paint_column_state* column, uint32_t viewFlags)
+{
+    rct_drawpixelinfo* dpi = &column->DPI;
     if (viewFlags
         & (VIEWPORT_FLAG_HIDE_VERTICAL | VIEWPORT_FLAG_HIDE_BASE | VIEWPORT_FLAG_UNDERGROUND_INSIDE | VIEWPORT_FLAG_CLIP_VIEW))
     {
@@ -919,18 +974,22 @@ static void viewport_paint_column(rct_drawpixelinfo* dpi, uint32_t viewFlags)
         gfx_clear(dpi, colour);
     }
 
-    paint_session* session = paint_session_alloc(dpi);
+    paint_session* session = column->Session;
     paint_session_generate(session);
     paint_struct ps = paint_session_arrange(session);
     paint_draw_structs(dpi, &ps, viewFlags);
-    paint_session_free(session);
+}
 
+static void viewport_paint_column(viewport_paint_column_state* column, uint32_t viewFlags)
+{
+    rct_drawpixelinfo* dpi = &column->DPI;
     if (gConfigGeneral.render_weather_gloom && !gTrackDesignSaveMode && !(viewFlags & VIEWPORT_FLAG_INVISIBLE_SPRITES)
         && !(viewFlags & VIEWPORT_FLAG_HIGHLIGHT_PATH_ISSUES))
     {
         viewport_paint_weather_gloom(dpi);
     }
 
+    paint_session* session = column->Session;
     if (session->PSStringHead != nullptr)
     {
         paint_draw_money_structs(dpi, session->PSStringHead);
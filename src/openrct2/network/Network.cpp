@@ -28,7 +28,7 @@
 // This string specifies which version of network stream current build uses.
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
-#define NETWORK_STREAM_VERSION "5"
+#define NETWORK_STREAM_VERSION "8"
 #define NETWORK_STREAM_ID OPENRCT2_VERSION "-" NETWORK_STREAM_VERSION
 
 static rct_peep* _pickup_peep = nullptr;
@@ -176,6 +176,8 @@ void Network::Close()
         game_command_queue.clear();
         player_list.clear();
         group_list.clear();
+        _mapSnapshot = nullptr;
+        _mapSnapshotObjects.clear();
 
         gfx_invalidate_screen();
 
@@ -655,6 +657,9 @@ const char* Network::FormatChat(NetworkPlayer* fromplayer, const char* text)
 
 void Network::SendPacketToClients(NetworkPacket& packet, bool front, bool gameCmd)
 {
+    // All the connections share the same packet and only keep track of how much of it they have sent
+    packet.Size = (uint16_t)packet.Data->size();
+    auto sharedPacket = std::make_shared<const NetworkPacket>(packet);
     for (auto& client_connection : client_connection_list)
     {
         if (gameCmd)
@@ -668,7 +673,7 @@ void Network::SendPacketToClients(NetworkPacket& packet, bool front, bool gameCm
                 continue;
             }
         }
-        client_connection->QueuePacket(NetworkPacket::Duplicate(packet), front);
+        client_connection->QueuePacket(sharedPacket, front);
     }
 }
 
@@ -1183,11 +1188,13 @@ void Network::Server_Send_MAP(NetworkConnection* connection)
         auto context = GetContext();
         auto objManager = context->GetObjectManager();
         objects = objManager->GetPackableObjects();
+
+        // The park has just been replaced, so any snapshot of the previous one is stale
+        _mapSnapshot = nullptr;
     }
 
-    size_t out_size;
-    uint8_t* header = save_for_network(out_size, objects);
-    if (header == nullptr)
+    auto snapshot = GetMapSnapshot(objects);
+    if (snapshot == nullptr)
     {
         if (connection)
         {
@@ -1196,76 +1203,104 @@ void Network::Server_Send_MAP(NetworkConnection* connection)
         }
         return;
     }
-    size_t chunksize = 65000;
-    for (size_t i = 0; i < out_size; i += chunksize)
+
+    // The packets are sent once the map has been compressed, the game carries on in the meantime
+    if (connection)
     {
-        size_t datasize = std::min(chunksize, out_size - i);
-        std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
-        *packet << (uint32_t)NETWORK_COMMAND_MAP << (uint32_t)out_size << (uint32_t)i;
-        packet->Write(&header[i], datasize);
-        if (connection)
-        {
-            connection->QueuePacket(std::move(packet));
-        }
-        else
+        connection->QueueDeferredPackets(snapshot);
+    }
+    else
+    {
+        for (auto& client_connection : client_connection_list)
         {
-            SendPacketToClients(*packet);
+            client_connection->QueueDeferredPackets(snapshot);
         }
     }
-    free(header);
 }
 
-uint8_t* Network::save_for_network(size_t& out_size, const std::vector<const ObjectRepositoryItem*>& objects) const
+/**
+ * Gets the map packets for the current game state. Clients that join during the same tick and request the same
+ * objects share one snapshot. The map is exported straight away as it has to match the current state, but compressing
+ * and splitting it into packets is left to a background task.
+ */
+std::shared_ptr<const NetworkDeferredPackets> Network::GetMapSnapshot(
+    const std::vector<const ObjectRepositoryItem*>& objects)
 {
-    uint8_t* header = nullptr;
-    out_size = 0;
+    // Commands can still be executed while paused without the tick advancing
+    if (_mapSnapshot != nullptr && _mapSnapshotTick == gCurrentTicks && !game_is_paused()
+        && _mapSnapshotObjects == objects)
+    {
+        return _mapSnapshot;
+    }
+
     bool RLEState = gUseRLE;
     gUseRLE = false;
-
-    auto ms = MemoryStream();
-    if (!SaveMap(&ms, objects))
+    auto ms = std::make_shared<MemoryStream>();
+    bool saved = SaveMap(ms.get(), objects);
+    gUseRLE = RLEState;
+    if (!saved)
     {
         log_warning("Failed to export map.");
+        _mapSnapshot = nullptr;
         return nullptr;
     }
-    gUseRLE = RLEState;
-
-    const void* data = ms.GetData();
-    int32_t size = ms.GetLength();
 
-    uint8_t* compressed = util_zlib_deflate((const uint8_t*)data, size, &out_size);
-    if (compressed != nullptr)
-    {
-        header = (uint8_t*)_strdup("open2_sv6_zlib");
-        size_t header_len = strlen((char*)header) + 1; // account for null terminator
-        header = (uint8_t*)realloc(header, header_len + out_size);
-        if (header == nullptr)
+    auto snapshot = std::make_shared<NetworkDeferredPackets>();
+    auto deferred = snapshot.get();
+    snapshot->Task.Run([ms, deferred]() {
+        // Nothing waits on the task, so a failure is reported through the snapshot and handled when flushing
+        try
         {
-            log_error("Failed to allocate %u bytes.", header_len + out_size);
+            deferred->Packets = CreateMapPackets(*ms);
         }
-        else
+        catch (const std::exception& ex)
         {
-            memcpy(&header[header_len], compressed, out_size);
-            out_size += header_len;
-            log_verbose("Sending map of size %u bytes, compressed to %u bytes", size, out_size);
+            log_error("Failed to create map packets: %s", ex.what());
+            deferred->Failed = true;
         }
+    });
+
+    _mapSnapshot = snapshot;
+    _mapSnapshotTick = gCurrentTicks;
+    _mapSnapshotObjects = objects;
+    return snapshot;
+}
+
+std::vector<std::shared_ptr<const NetworkPacket>> Network::CreateMapPackets(const MemoryStream& ms)
+{
+    const uint8_t* data = (const uint8_t*)ms.GetData();
+    size_t size = ms.GetLength();
+
+    std::vector<uint8_t> buffer;
+    size_t compressedSize;
+    uint8_t* compressed = util_zlib_deflate(data, size, &compressedSize);
+    if (compressed != nullptr)
+    {
+        static constexpr const char header[] = "open2_sv6_zlib"; // sent with its null terminator
+        buffer.reserve(sizeof(header) + compressedSize);
+        buffer.insert(buffer.end(), header, header + sizeof(header));
+        buffer.insert(buffer.end(), compressed, compressed + compressedSize);
         free(compressed);
+        log_verbose("Sending map of size %u bytes, compressed to %u bytes", size, buffer.size());
     }
     else
     {
         log_warning("Failed to compress the data, falling back to non-compressed sv6.");
-        header = (uint8_t*)malloc(size);
-        if (header == nullptr)
-        {
-            log_error("Failed to allocate %u bytes.", size);
-        }
-        else
-        {
-            out_size = size;
-            memcpy(header, data, size);
-        }
+        buffer.assign(data, data + size);
     }
-    return header;
+
+    std::vector<std::shared_ptr<const NetworkPacket>> packets;
+    size_t chunksize = 65000;
+    for (size_t i = 0; i < buffer.size(); i += chunksize)
+    {
+        size_t datasize = std::min(chunksize, buffer.size() - i);
+        std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
+        *packet << (uint32_t)NETWORK_COMMAND_MAP << (uint32_t)buffer.size() << (uint32_t)i;
+        packet->Write(&buffer[i], datasize);
+        packet->Size = (uint16_t)packet->Data->size();
+        packets.push_back(std::move(packet));
+    }
+    return packets;
 }
 
 void Network::Client_Send_CHAT(const char* text)
@@ -1349,17 +1384,8 @@ void Network::Server_Send_TICK()
 
     std::unique_ptr<NetworkPacket> packet(NetworkPacket::Allocate());
     *packet << (uint32_t)NETWORK_COMMAND_TICK << gCurrentTicks << gScenarioSrand0;
-    uint32_t flags = 0;
-    // Simple counter which limits how often a sprite checksum gets sent.
-    // This can get somewhat expensive, so we don't want to push it every tick in release,
-    // but debug version can check more often.
-    static int32_t checksum_counter = 0;
-    checksum_counter++;
-    if (checksum_counter >= 100)
-    {
-        checksum_counter = 0;
-        flags |= NETWORK_TICK_FLAG_CHECKSUMS;
-    }
+    // The sprite checksum is cheap enough to send every tick, which lets clients detect a desync straight away.
+    uint32_t flags = NETWORK_TICK_FLAG_CHECKSUMS;
     // Send flags always, so we can understand packet structure on the other end,
     // and allow for some expansion.
     *packet << flags;
@@ -2242,7 +2268,6 @@ bool Network::LoadMap(IStream* stream)
         [[maybe_unused]] uint32_t checksum = stream->ReadValue<uint32_t>();
 
         // Read other data not in normal save files
-        stream->Read(gSpriteSpatialIndex, 0x10001 * sizeof(uint16_t));
         gGamePaused = stream->ReadValue<uint32_t>();
         _guestGenerationProbability = stream->ReadValue<uint32_t>();
         _suggestedGuestMaximum = stream->ReadValue<uint32_t>();
@@ -2289,7 +2314,6 @@ bool Network::SaveMap(IStream* stream, const std::vector<const ObjectRepositoryI
         s6exporter->SaveGame(stream);
 
         // Write other data not in normal save files
-        stream->Write(gSpriteSpatialIndex, 0x10001 * sizeof(uint16_t));
         stream->WriteValue<uint32_t>(gGamePaused);
         stream->WriteValue<uint32_t>(_guestGenerationProbability);
         stream->WriteValue<uint32_t>(_suggestedGuestMaximum);
@@ -79,55 +79,133 @@ int32_t NetworkConnection::ReadPacket()
     return NETWORK_READPACKET_MORE_DATA;
 }
 
-bool NetworkConnection::SendPacket(NetworkPacket& packet)
+void NetworkConnection::QueuePacket(std::unique_ptr<NetworkPacket> packet, bool front)
 {
-    uint16_t sizen = Convert::HostToNetwork(packet.Size);
-    std::vector<uint8_t> tosend;
-    tosend.reserve(sizeof(sizen) + packet.Size);
-    tosend.insert(tosend.end(), (uint8_t*)&sizen, (uint8_t*)&sizen + sizeof(sizen));
-    tosend.insert(tosend.end(), packet.Data->begin(), packet.Data->end());
-
-    const void* buffer = &tosend[packet.BytesTransferred];
-    size_t bufferSize = tosend.size() - packet.BytesTransferred;
-    size_t sent = Socket->SendData(buffer, bufferSize);
-    if (sent > 0)
-    {
-        packet.BytesTransferred += sent;
-    }
-    return packet.BytesTransferred == tosend.size();
+    packet->Size = (uint16_t)packet->Data->size();
+    QueuePacket(std::shared_ptr<const NetworkPacket>(std::move(packet)), front);
 }
 
-void NetworkConnection::QueuePacket(std::unique_ptr<NetworkPacket> packet, bool front)
+/**
+ * Queues a packet that may also be queued on other connections. Its size must already be set and it must not be
+ * modified until it has been sent.
+ */
+void NetworkConnection::QueuePacket(std::shared_ptr<const NetworkPacket> packet, bool front)
 {
     if (AuthStatus == NETWORK_AUTH_OK || !packet->CommandRequiresAuth())
     {
-        packet->Size = (uint16_t)packet->Data->size();
+        OutboundPacket outboundPacket = { std::move(packet), 0, 0, nullptr };
+        outboundPacket.SizeHeader = Convert::HostToNetwork(outboundPacket.Packet->Size);
         if (front)
         {
             // If the first packet was already partially sent add new packet to second position
-            if (!_outboundPackets.empty() && _outboundPackets.front()->BytesTransferred > 0)
+            if (!_outboundPackets.empty() && _outboundPackets.front().BytesTransferred > 0)
             {
                 auto it = _outboundPackets.begin();
                 it++; // Second position
-                _outboundPackets.insert(it, std::move(packet));
+                _outboundPackets.insert(it, std::move(outboundPacket));
             }
             else
             {
-                _outboundPackets.push_front(std::move(packet));
+                _outboundPackets.push_front(std::move(outboundPacket));
             }
         }
         else
         {
-            _outboundPackets.push_back(std::move(packet));
+            _outboundPackets.push_back(std::move(outboundPacket));
+        }
+    }
+}
+
+/**
+ * Queues packets that are still being produced. Nothing queued after them is sent until they are ready. As their
+ * commands are not known yet, they are only queued on authenticated connections.
+ */
+void NetworkConnection::QueueDeferredPackets(std::shared_ptr<const NetworkDeferredPackets> deferred)
+{
+    if (AuthStatus == NETWORK_AUTH_OK)
+    {
+        _outboundPackets.push_back({ nullptr, 0, 0, std::move(deferred) });
+    }
+}
+
+/**
+ * Replaces the deferred packets at the front of the queue with the packets they produced. Returns false if the
+ * front of the queue is still waiting on a task, or if the task failed and the connection has been dropped.
+ */
+bool NetworkConnection::ExpandDeferredPackets()
+{
+    while (!_outboundPackets.empty() && _outboundPackets.front().Deferred != nullptr)
+    {
+        auto deferred = _outboundPackets.front().Deferred;
+        if (!deferred->Task.IsComplete())
+        {
+            return false;
+        }
+        if (deferred->Failed)
+        {
+            // The client would wait for the packets forever, so drop the connection instead
+            _outboundPackets.clear();
+            SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
+            Socket->Disconnect();
+            return false;
+        }
+        _outboundPackets.pop_front();
+        for (auto it = deferred->Packets.rbegin(); it != deferred->Packets.rend(); it++)
+        {
+            _outboundPackets.push_front({ *it, Convert::HostToNetwork((*it)->Size), 0, nullptr });
         }
     }
+    return true;
 }
 
 void NetworkConnection::SendQueuedPackets()
 {
-    while (!_outboundPackets.empty() && SendPacket(*_outboundPackets.front()))
+    while (ExpandDeferredPackets() && !_outboundPackets.empty())
     {
-        _outboundPackets.remove(_outboundPackets.front());
+        // Gather the size header and data of as many queued packets as possible into a single send
+        SocketBuffer buffers[SOCKET_MAX_SEND_BUFFERS];
+        size_t numBuffers = 0;
+        size_t bufferedSize = 0;
+        for (auto it = _outboundPackets.begin();
+             it != _outboundPackets.end() && it->Deferred == nullptr && numBuffers + 2 <= SOCKET_MAX_SEND_BUFFERS; it++)
+        {
+            size_t offset = it->BytesTransferred;
+            if (offset < sizeof(it->SizeHeader))
+            {
+                buffers[numBuffers++] = { (const uint8_t*)&it->SizeHeader + offset, sizeof(it->SizeHeader) - offset };
+                bufferedSize += sizeof(it->SizeHeader) - offset;
+                offset = 0;
+            }
+            else
+            {
+                offset -= sizeof(it->SizeHeader);
+            }
+            buffers[numBuffers++] = { it->Packet->Data->data() + offset, it->Packet->Size - offset };
+            bufferedSize += it->Packet->Size - offset;
+        }
+
+        // Remove the packets that were sent completely
+        size_t sent = Socket->SendData(buffers, numBuffers);
+        size_t remaining = sent;
+        while (remaining > 0)
+        {
+            auto& outboundPacket = _outboundPackets.front();
+            size_t packetRemaining = sizeof(outboundPacket.SizeHeader) + outboundPacket.Packet->Size
+                - outboundPacket.BytesTransferred;
+            if (remaining < packetRemaining)
+            {
+                outboundPacket.BytesTransferred += remaining;
+                break;
+            }
+            remaining -= packetRemaining;
+            _outboundPackets.pop_front();
+        }
+
+        if (sent < bufferedSize)
+        {
+            // The socket can not take any more for now
+            break;
+        }
     }
 }
 
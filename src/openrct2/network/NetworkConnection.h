@@ -11,11 +11,12 @@
 
 #ifndef DISABLE_NETWORK
 #    include "../common.h"
+#    include "../core/TaskScheduler.hpp"
 #    include "NetworkKey.h"
 #    include "NetworkPacket.h"
 #    include "NetworkTypes.h"
 
-#    include <list>
+#    include <deque>
 #    include <memory>
 #    include <vector>
 
@@ -23,6 +24,19 @@ interface ITcpSocket;
 class NetworkPlayer;
 struct ObjectRepositoryItem;
 
+/**
+ * Packets that are produced by a background task, e.g. a compressed map. They can be queued on any number of
+ * connections before the task has finished.
+ */
+struct NetworkDeferredPackets
+{
+    std::vector<std::shared_ptr<const NetworkPacket>> Packets;
+    // Set by the task if the packets could not be produced
+    bool Failed = false;
+    // Declared last so that it waits for the task before the packets are destroyed
+    TaskGroup Task;
+};
+
 class NetworkConnection final
 {
 public:
@@ -40,6 +54,8 @@ public:
 
     int32_t ReadPacket();
     void QueuePacket(std::unique_ptr<NetworkPacket> packet, bool front = false);
+    void QueuePacket(std::shared_ptr<const NetworkPacket> packet, bool front = false);
+    void QueueDeferredPackets(std::shared_ptr<const NetworkDeferredPackets> deferred);
     void SendQueuedPackets();
     void ResetLastPacketTime();
     bool ReceivedPacketRecently();
@@ -49,11 +65,21 @@ public:
     void SetLastDisconnectReason(const rct_string_id string_id, void* args = nullptr);
 
 private:
-    std::list<std::unique_ptr<NetworkPacket>> _outboundPackets;
+    // Packets may be shared between connections, so how much of each one has been sent is tracked here
+    struct OutboundPacket
+    {
+        std::shared_ptr<const NetworkPacket> Packet;
+        uint16_t SizeHeader;
+        size_t BytesTransferred;
+        // Set instead of Packet while waiting for the deferred packets to be produced
+        std::shared_ptr<const NetworkDeferredPackets> Deferred;
+    };
+
+    bool ExpandDeferredPackets();
+
+    std::deque<OutboundPacket> _outboundPackets;
     uint32_t _lastPacketTime = 0;
     utf8* _lastDisconnectReason = nullptr;
-
-    bool SendPacket(NetworkPacket& packet);
 };
 
 #endif // DISABLE_NETWORK
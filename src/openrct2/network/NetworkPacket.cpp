@@ -20,17 +20,12 @@ std::unique_ptr<NetworkPacket> NetworkPacket::Allocate()
     return std::make_unique<NetworkPacket>();
 }
 
-std::unique_ptr<NetworkPacket> NetworkPacket::Duplicate(NetworkPacket& packet)
-{
-    return std::make_unique<NetworkPacket>(packet);
-}
-
 uint8_t* NetworkPacket::GetData()
 {
     return &(*Data)[0];
 }
 
-int32_t NetworkPacket::GetCommand()
+int32_t NetworkPacket::GetCommand() const
 {
     if (Data->size() >= sizeof(uint32_t))
     {
@@ -49,7 +44,7 @@ void NetworkPacket::Clear()
     Data->clear();
 }
 
-bool NetworkPacket::CommandRequiresAuth()
+bool NetworkPacket::CommandRequiresAuth() const
 {
     switch (GetCommand())
     {
@@ -25,13 +25,12 @@ public:
     size_t BytesRead = 0;
 
     static std::unique_ptr<NetworkPacket> Allocate();
-    static std::unique_ptr<NetworkPacket> Duplicate(NetworkPacket& packet);
 
     uint8_t* GetData();
-    int32_t GetCommand();
+    int32_t GetCommand() const;
 
     void Clear();
-    bool CommandRequiresAuth();
+    bool CommandRequiresAuth() const;
 
     const uint8_t* Read(size_t size);
     const utf8* ReadString();
@@ -35,6 +35,7 @@
         #define SHUT_RDWR SD_BOTH
     #endif
     #define FLAG_NO_PIPE 0
+    using SEND_VECTOR = WSABUF;
 #else
     #include <cerrno>
     #include <arpa/inet.h>
@@ -42,9 +43,11 @@
     #include <netinet/tcp.h>
     #include <netinet/in.h>
     #include <sys/socket.h>
+    #include <sys/uio.h>
     #include <fcntl.h>
     #include "../common.h"
     using SOCKET = int32_t;
+    using SEND_VECTOR = iovec;
     #define SOCKET_ERROR -1
     #define INVALID_SOCKET -1
     #define LAST_SOCKET_ERROR() errno
@@ -346,25 +349,60 @@ public:
         }
     }
 
-    size_t SendData(const void* buffer, size_t size) override
+    size_t SendData(const SocketBuffer* buffers, size_t count) override
     {
         if (_status != SOCKET_STATUS_CONNECTED)
         {
             throw std::runtime_error("Socket not connected.");
         }
+        if (count > SOCKET_MAX_SEND_BUFFERS)
+        {
+            throw std::invalid_argument("Too many buffers.");
+        }
+
+        SEND_VECTOR vectors[SOCKET_MAX_SEND_BUFFERS];
+        for (size_t i = 0; i < count; i++)
+        {
+            SetSendVector(vectors[i], buffers[i].Data, buffers[i].Size);
+        }
 
+        // Keep sending until everything is sent or the socket would block
         size_t totalSent = 0;
-        do
+        size_t first = 0;
+        size_t firstOffset = 0;
+        while (first < count)
         {
-            const char* bufferStart = (const char*)buffer + totalSent;
-            size_t remainingSize = size - totalSent;
-            int32_t sentBytes = send(_socket, bufferStart, (int32_t)remainingSize, FLAG_NO_PIPE);
+#    ifdef _WIN32
+            DWORD sentBytes = 0;
+            if (WSASend(_socket, &vectors[first], (DWORD)(count - first), &sentBytes, 0, nullptr, nullptr) == SOCKET_ERROR)
+            {
+                break;
+            }
+#    else
+            msghdr message = {};
+            message.msg_iov = &vectors[first];
+            message.msg_iovlen = count - first;
+            ssize_t sentBytes = sendmsg(_socket, &message, FLAG_NO_PIPE);
             if (sentBytes == SOCKET_ERROR)
             {
-                return totalSent;
+                break;
             }
+#    endif
             totalSent += sentBytes;
-        } while (totalSent < size);
+
+            // Skip over the buffers that have been sent and trim the one that was sent partially
+            size_t remaining = sentBytes + firstOffset;
+            while (first < count && remaining >= buffers[first].Size)
+            {
+                remaining -= buffers[first].Size;
+                first++;
+            }
+            firstOffset = remaining;
+            if (first < count)
+            {
+                SetSendVector(vectors[first], (const uint8_t*)buffers[first].Data + firstOffset, buffers[first].Size - firstOffset);
+            }
+        }
         return totalSent;
     }
 
@@ -486,6 +524,17 @@ private:
 #    endif
     }
 
+    static void SetSendVector(SEND_VECTOR& vector, const void* data, size_t size)
+    {
+#    ifdef _WIN32
+        vector.buf = (CHAR*)data;
+        vector.len = (ULONG)size;
+#    else
+        vector.iov_base = (void*)data;
+        vector.iov_len = size;
+#    endif
+    }
+
     static bool SetTCPNoDelay(SOCKET socket, bool enabled)
     {
         return setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, (const char*)&enabled, sizeof(enabled)) == 0;
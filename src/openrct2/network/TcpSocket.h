@@ -11,6 +11,8 @@
 
 #include "../common.h"
 
+constexpr size_t SOCKET_MAX_SEND_BUFFERS = 64;
+
 enum SOCKET_STATUS
 {
     SOCKET_STATUS_CLOSED,
@@ -28,6 +30,15 @@ enum NETWORK_READPACKET
     NETWORK_READPACKET_DISCONNECTED
 };
 
+/**
+ * A piece of data to be sent as part of a gathered send.
+ */
+struct SocketBuffer
+{
+    const void* Data;
+    size_t Size;
+};
+
 /**
  * Represents a TCP socket / connection or listener.
  */
@@ -49,7 +60,7 @@ public:
     virtual void Connect(const char* address, uint16_t port) abstract;
     virtual void ConnectAsync(const char* address, uint16_t port) abstract;
 
-    virtual size_t SendData(const void* buffer, size_t size) abstract;
+    virtual size_t SendData(const SocketBuffer* buffers, size_t count) abstract;
     virtual NETWORK_READPACKET ReceiveData(void* buffer, size_t size, size_t* sizeReceived) abstract;
 
     virtual void Disconnect() abstract;
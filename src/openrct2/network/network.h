@@ -302,7 +302,12 @@ private:
     void Client_Handle_OBJECTS(NetworkConnection& connection, NetworkPacket& packet);
     void Server_Handle_OBJECTS(NetworkConnection& connection, NetworkPacket& packet);
 
-    uint8_t* save_for_network(size_t& out_size, const std::vector<const ObjectRepositoryItem*>& objects) const;
+    std::shared_ptr<const NetworkDeferredPackets> GetMapSnapshot(const std::vector<const ObjectRepositoryItem*>& objects);
+    static std::vector<std::shared_ptr<const NetworkPacket>> CreateMapPackets(const MemoryStream& ms);
+
+    std::shared_ptr<NetworkDeferredPackets> _mapSnapshot;
+    uint32_t _mapSnapshotTick = 0;
+    std::vector<const ObjectRepositoryItem*> _mapSnapshotObjects;
 
     std::ofstream _chat_log_fs;
     std::ofstream _server_log_fs;
@@ -17,17 +17,6 @@
 #include <memory>
 #include <stdexcept>
 
-ImageTable::~ImageTable()
-{
-    if (_data == nullptr)
-    {
-        for (auto& entry : _entries)
-        {
-            delete[] entry.offset;
-        }
-    }
-}
-
 void ImageTable::Read(IReadObjectContext* context, IStream* stream)
 {
     if (gOpenRCT2NoGraphics)
@@ -107,8 +96,20 @@ void ImageTable::AddImage(const rct_g1_element* g1)
     }
     else
     {
-        newg1.offset = new uint8_t[length];
-        std::copy_n(g1->offset, length, newg1.offset);
+        auto data = std::make_unique<uint8_t[]>(length);
+        std::copy_n(g1->offset, length, data.get());
+        newg1.offset = data.get();
+        _imageData.push_back(std::move(data));
     }
     _entries.push_back(newg1);
 }
+
+void ImageTable::AddImage(const rct_g1_element* g1, const std::shared_ptr<const void>& source)
+{
+    // Images tend to be added in runs from the same source
+    if (_sources.empty() || _sources.back() != source)
+    {
+        _sources.push_back(source);
+    }
+    _entries.push_back(*g1);
+}
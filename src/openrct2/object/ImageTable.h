@@ -23,12 +23,14 @@ class ImageTable
 private:
     std::unique_ptr<uint8_t[]> _data;
     std::vector<rct_g1_element> _entries;
+    // Data of images added one at a time, either copied or kept alive through the source it belongs to
+    std::vector<std::unique_ptr<uint8_t[]>> _imageData;
+    std::vector<std::shared_ptr<const void>> _sources;
 
 public:
     ImageTable() = default;
     ImageTable(const ImageTable&) = delete;
     ImageTable& operator=(const ImageTable&) = delete;
-    ~ImageTable();
 
     void Read(IReadObjectContext* context, IStream* stream);
     const rct_g1_element* GetImages() const
@@ -40,4 +42,10 @@ public:
         return (uint32_t)_entries.size();
     }
     void AddImage(const rct_g1_element* g1);
+
+    /**
+     * Adds an image without copying its data, the data must belong to the given source which is kept alive for as long
+     * as the table is.
+     */
+    void AddImage(const rct_g1_element* g1, const std::shared_ptr<const void>& source);
 };
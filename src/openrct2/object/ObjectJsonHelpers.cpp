@@ -28,6 +28,8 @@
 #include <algorithm>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 using namespace OpenRCT2;
@@ -215,37 +217,98 @@ namespace ObjectJsonHelpers
         return objectPath;
     }
 
-    static std::vector<rct_g1_element> LoadObjectImages(
-        IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range)
+    struct LegacyImageSource
     {
-        std::vector<rct_g1_element> result;
-        auto objectPath = FindLegacyObject(name);
-        auto obj = ObjectFactory::CreateObjectFromLegacyFile(context->GetObjectRepository(), objectPath.c_str());
-        if (obj != nullptr)
+        std::once_flag Loaded;
+        std::string Path;
+        std::unique_ptr<const Object> Source;
+    };
+
+    static std::mutex _legacyImageCacheMutex;
+    static std::unordered_map<std::string, std::shared_ptr<LegacyImageSource>> _legacyImageCache;
+    static size_t _legacyImageCacheScopes = 0;
+
+    LegacyImageCacheScope::LegacyImageCacheScope()
+    {
+        std::lock_guard<std::mutex> lock(_legacyImageCacheMutex);
+        _legacyImageCacheScopes++;
+    }
+
+    LegacyImageCacheScope::~LegacyImageCacheScope()
+    {
+        // Sources still used by loaded objects are kept alive by their image tables
+        std::lock_guard<std::mutex> lock(_legacyImageCacheMutex);
+        if (--_legacyImageCacheScopes == 0)
+        {
+            _legacyImageCache.clear();
+        }
+    }
+
+    static std::shared_ptr<LegacyImageSource> GetLegacyImageSource(IReadObjectContext* context, const std::string& name)
+    {
+        std::shared_ptr<LegacyImageSource> source;
+        {
+            std::lock_guard<std::mutex> lock(_legacyImageCacheMutex);
+            if (_legacyImageCacheScopes > 0)
+            {
+                auto& entry = _legacyImageCache[name];
+                if (entry == nullptr)
+                {
+                    entry = std::make_shared<LegacyImageSource>();
+                }
+                source = entry;
+            }
+            else
+            {
+                source = std::make_shared<LegacyImageSource>();
+            }
+        }
+
+        // Decode outside of the lock, other threads wanting the same object wait for it here
+        std::call_once(source->Loaded, [context, &name, &source]() {
+            source->Path = FindLegacyObject(name);
+            source->Source.reset(
+                ObjectFactory::CreateObjectFromLegacyFile(context->GetObjectRepository(), source->Path.c_str()));
+        });
+        return source;
+    }
+
+    static void LoadObjectImages(
+        IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range, ImageTable& imageTable)
+    {
+        auto source = GetLegacyImageSource(context, name);
+        if (source->Source != nullptr)
         {
-            auto& imgTable = static_cast<const Object*>(obj)->GetImageTable();
+            auto& imgTable = source->Source->GetImageTable();
             auto numImages = (int32_t)imgTable.GetCount();
             auto images = imgTable.GetImages();
+
+            // Sharing keeps all of the decoded object alive, so only share when most of its images are used
+            auto numUsed = std::count_if(
+                range.begin(), range.end(), [numImages](int32_t i) { return i >= 0 && i < numImages; });
+            bool shareImages = numUsed * 2 >= numImages;
+
             size_t placeHoldersAdded = 0;
             for (auto i : range)
             {
                 if (i >= 0 && i < numImages)
                 {
-                    auto& objg1 = images[i];
-                    auto length = g1_calculate_data_size(&objg1);
-                    auto g1 = objg1;
-                    g1.offset = (uint8_t*)std::malloc(length);
-                    std::memcpy(g1.offset, objg1.offset, length);
-                    result.push_back(g1);
+                    if (shareImages)
+                    {
+                        imageTable.AddImage(&images[i], source);
+                    }
+                    else
+                    {
+                        imageTable.AddImage(&images[i]);
+                    }
                 }
                 else
                 {
                     auto g1 = rct_g1_element{};
-                    result.push_back(g1);
+                    imageTable.AddImage(&g1);
                     placeHoldersAdded++;
                 }
             }
-            delete obj;
 
             // Log place holder information
             if (placeHoldersAdded > 0)
@@ -256,11 +319,32 @@ namespace ObjectJsonHelpers
         }
         else
         {
-            std::string msg = "Unable to open '" + objectPath + "'";
+            std::string msg = "Unable to open '" + source->Path + "'";
             context->LogWarning(OBJECT_ERROR_INVALID_PROPERTY, msg.c_str());
-            result.resize(range.size());
+            for (size_t i = 0; i < range.size(); i++)
+            {
+                auto g1 = rct_g1_element{};
+                imageTable.AddImage(&g1);
+            }
         }
-        return result;
+    }
+
+    static bool LoadObjectImages(IReadObjectContext* context, const std::string& s, ImageTable& imageTable)
+    {
+        if (!String::StartsWith(s, "$RCT2:OBJDATA/"))
+        {
+            return false;
+        }
+
+        auto name = s.substr(14);
+        auto rangeStart = name.find('[');
+        if (rangeStart != std::string::npos)
+        {
+            auto range = ParseRange(name.substr(rangeStart));
+            name = name.substr(0, rangeStart);
+            LoadObjectImages(context, name, range, imageTable);
+        }
+        return true;
     }
 
     static std::vector<rct_g1_element> ParseImages(IReadObjectContext* context, std::string s)
@@ -314,18 +398,6 @@ namespace ObjectJsonHelpers
                 }
             }
         }
-        else if (String::StartsWith(s, "$RCT2:OBJDATA/"))
-        {
-            auto name = s.substr(14);
-            auto rangeStart = name.find('[');
-            if (rangeStart != std::string::npos)
-            {
-                auto rangeString = name.substr(rangeStart);
-                auto range = ParseRange(name.substr(rangeStart));
-                name = name.substr(0, rangeStart);
-                result = LoadObjectImages(context, name, range);
-            }
-        }
         else
         {
             try
@@ -438,6 +510,10 @@ namespace ObjectJsonHelpers
                 if (json_is_string(el))
                 {
                     auto s = json_string_value(el);
+                    if (LoadObjectImages(context, s, imageTable))
+                    {
+                        continue;
+                    }
                     images = ParseImages(context, s);
                 }
                 else if (json_is_object(el))
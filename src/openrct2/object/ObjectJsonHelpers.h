@@ -35,6 +35,19 @@ namespace ObjectJsonHelpers
     void LoadStrings(const json_t* root, StringTable& stringTable);
     void LoadImages(IReadObjectContext* context, const json_t* root, ImageTable& imageTable);
 
+    /**
+     * While any scope is alive, legacy objects that JSON objects take images from stay decoded so that each one is only
+     * decoded once, however many JSON objects use it. Hold one around loading many objects at once.
+     */
+    class LegacyImageCacheScope final
+    {
+    public:
+        LegacyImageCacheScope();
+        LegacyImageCacheScope(const LegacyImageCacheScope&) = delete;
+        LegacyImageCacheScope& operator=(const LegacyImageCacheScope&) = delete;
+        ~LegacyImageCacheScope();
+    };
+
     template<typename T> static T GetFlags(const json_t* obj, std::initializer_list<std::pair<std::string, T>> list)
     {
         T flags = 0;
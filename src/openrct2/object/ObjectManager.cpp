@@ -13,10 +13,12 @@
 #include "../ParkImporter.h"
 #include "../core/Console.hpp"
 #include "../core/Memory.hpp"
+#include "../core/TaskScheduler.hpp"
 #include "../localisation/StringIds.h"
 #include "FootpathItemObject.h"
 #include "LargeSceneryObject.h"
 #include "Object.h"
+#include "ObjectJsonHelpers.h"
 #include "ObjectList.h"
 #include "ObjectRepository.h"
 #include "SceneryGroupObject.h"
@@ -26,8 +28,6 @@
 #include <algorithm>
 #include <array>
 #include <memory>
-#include <mutex>
-#include <thread>
 #include <unordered_set>
 
 class ObjectManager final : public IObjectManager
@@ -493,30 +493,6 @@ private:
         return requiredObjects;
     }
 
-    template<typename T, typename TFunc> static void ParallelFor(const std::vector<T>& items, TFunc func)
-    {
-        auto partitions = std::thread::hardware_concurrency();
-        auto partitionSize = (items.size() + (partitions - 1)) / partitions;
-        std::vector<std::thread> threads;
-        for (size_t n = 0; n < partitions; n++)
-        {
-            auto begin = n * partitionSize;
-            auto end = std::min(items.size(), begin + partitionSize);
-            threads.emplace_back(
-                [func](size_t pbegin, size_t pend) {
-                    for (size_t i = pbegin; i < pend; i++)
-                    {
-                        func(i);
-                    }
-                },
-                begin, end);
-        }
-        for (auto& t : threads)
-        {
-            t.join();
-        }
-    }
-
     std::vector<Object*> LoadObjects(std::vector<const ObjectRepositoryItem*>& requiredObjects, size_t* outNewObjectsLoaded)
     {
         std::vector<Object*> objects;
@@ -525,34 +501,51 @@ private:
         objects.resize(OBJECT_ENTRY_COUNT);
         loadedObjects.reserve(OBJECT_ENTRY_COUNT);
 
-        // Read objects
-        std::mutex commonMutex;
-        ParallelFor(requiredObjects, [this, &commonMutex, requiredObjects, &objects, &badObjects, &loadedObjects](size_t i) {
-            auto ori = requiredObjects[i];
-            Object* loadedObject = nullptr;
-            if (ori != nullptr)
-            {
-                loadedObject = ori->LoadedObject;
-                if (loadedObject == nullptr)
+        // Read objects, sharing any legacy images that several objects take their images from. Objects differ a lot in
+        // size, so each one is its own task.
+        ObjectJsonHelpers::LegacyImageCacheScope legacyImageCacheScope;
+        std::vector<Object*> readObjects(requiredObjects.size());
+        TaskScheduler::ParallelFor(
+            0, requiredObjects.size(), 1, [this, &requiredObjects, &readObjects](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++)
                 {
-                    loadedObject = _objectRepository->LoadObject(ori);
-                    if (loadedObject == nullptr)
-                    {
-                        std::lock_guard<std::mutex> guard(commonMutex);
-                        badObjects.push_back(ori->ObjectEntry);
-                        ReportObjectLoadProblem(&ori->ObjectEntry);
-                    }
-                    else
+                    auto ori = requiredObjects[i];
+                    if (ori != nullptr && ori->LoadedObject == nullptr)
                     {
-                        std::lock_guard<std::mutex> guard(commonMutex);
-                        loadedObjects.push_back(loadedObject);
-                        // Connect the ori to the registered object
-                        _objectRepository->RegisterLoadedObject(ori, loadedObject);
+                        readObjects[i] = _objectRepository->LoadObject(ori);
                     }
                 }
+            });
+
+        // Register the objects in entry order so that images are always allocated in the same order
+        for (size_t i = 0; i < requiredObjects.size(); i++)
+        {
+            auto ori = requiredObjects[i];
+            if (ori == nullptr)
+            {
+                continue;
+            }
+
+            Object* loadedObject = ori->LoadedObject;
+            if (loadedObject != nullptr)
+            {
+                // Already loaded, or read more than once because several entries refer to it
+                delete readObjects[i];
+            }
+            else if (readObjects[i] == nullptr)
+            {
+                badObjects.push_back(ori->ObjectEntry);
+                ReportObjectLoadProblem(&ori->ObjectEntry);
+            }
+            else
+            {
+                loadedObject = readObjects[i];
+                loadedObjects.push_back(loadedObject);
+                // Connect the ori to the registered object
+                _objectRepository->RegisterLoadedObject(ori, loadedObject);
             }
             objects[i] = loadedObject;
-        });
+        }
 
         // Load objects
         for (auto obj : loadedObjects)
@@ -33,6 +33,7 @@
 #include "../util/Util.h"
 #include "Object.h"
 #include "ObjectFactory.h"
+#include "ObjectJsonHelpers.h"
 #include "ObjectList.h"
 #include "ObjectManager.h"
 #include "RideObject.h"
@@ -228,6 +229,8 @@ public:
     void LoadOrConstruct(int32_t language) override
     {
         ClearItems();
+        // Building the index creates every JSON object, share the legacy images they take their images from
+        ObjectJsonHelpers::LegacyImageCacheScope legacyImageCacheScope;
         auto items = _fileIndex.LoadOrBuild(language);
         AddItems(items);
         SortItems();
@@ -235,6 +238,7 @@ public:
 
     void Construct(int32_t language) override
     {
+        ObjectJsonHelpers::LegacyImageCacheScope legacyImageCacheScope;
         auto items = _fileIndex.Rebuild(language);
         AddItems(items);
         SortItems();
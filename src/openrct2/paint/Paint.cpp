@@ -10,6 +10,7 @@
 #include "Paint.h"
 
 #include "../config/Config.h"
+#include "../core/Profiler.hpp"
 #include "../drawing/Drawing.h"
 #include "../interface/Viewport.h"
 #include "../localisation/Localisation.h"
@@ -18,14 +19,21 @@
 #include "tile_element/Paint.TileElement.h"
 
 #include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 // Globals for paint clipping
 uint8_t gClipHeight = 128; // Default to middle value
 LocationXY8 gClipSelectionA = { 0, 0 };
 LocationXY8 gClipSelectionB = { MAXIMUM_MAP_SIZE_TECHNICAL - 1, MAXIMUM_MAP_SIZE_TECHNICAL - 1 };
 
-paint_session gPaintSession;
-static bool _paintSessionInUse;
+// Sessions are pooled so that several viewport columns can be painted at the same time
+static std::vector<std::unique_ptr<paint_session>> _paintSessionPool;
+static std::vector<paint_session*> _freePaintSessions;
+static std::mutex _paintSessionPoolMutex;
+
+std::mutex gPaintTextMutex;
 
 static constexpr const uint8_t BoundBoxDebugColours[] = {
     0,   // NONE
@@ -54,11 +62,37 @@ static void paint_ps_image_with_bounding_boxes(
 static void paint_ps_image(rct_drawpixelinfo* dpi, paint_struct* ps, uint32_t imageId, int16_t x, int16_t y);
 static uint32_t paint_ps_colourify_image(uint32_t imageId, uint8_t spriteType, uint32_t viewFlags);
 
+static void paint_session_set_block(paint_session* session, size_t blockIndex)
+{
+    if (blockIndex == session->PaintStructBlocks.size())
+    {
+        session->PaintStructBlocks.push_back(std::make_unique<paint_entry[]>(PAINT_STRUCT_BLOCK_SIZE));
+    }
+    session->PaintStructBlockIndex = blockIndex;
+    session->NextFreePaintStruct = session->PaintStructBlocks[blockIndex].get();
+    session->EndOfPaintStructArray = session->NextFreePaintStruct + PAINT_STRUCT_BLOCK_SIZE;
+}
+
+/**
+ * Makes NextFreePaintStruct point to a free entry, moving on to the next block when the current one is full. Returns
+ * false if the session has run out of blocks, in which case nothing more can be painted.
+ */
+static bool paint_session_reserve_entry(paint_session* session)
+{
+    if (session->NextFreePaintStruct < session->EndOfPaintStructArray)
+        return true;
+    if (session->PaintStructBlockIndex + 1 >= PAINT_STRUCT_MAX_BLOCKS)
+        return false;
+
+    paint_session_set_block(session, session->PaintStructBlockIndex + 1);
+    return true;
+}
+
 static void paint_session_init(paint_session* session, rct_drawpixelinfo* dpi)
 {
     session->DPI = dpi;
-    session->EndOfPaintStructArray = &session->PaintStructs[4000 - 1];
-    session->NextFreePaintStruct = session->PaintStructs;
+    // Blocks allocated by earlier uses of the session are reused
+    paint_session_set_block(session, 0);
     session->UnkF1AD28 = nullptr;
     session->UnkF1AD2C = nullptr;
     for (auto& quadrant : session->Quadrants)
@@ -91,7 +125,7 @@ static void paint_session_add_ps_to_quadrant(paint_session* session, paint_struc
 static paint_struct* sub_9819_c(
     paint_session* session, uint32_t image_id, LocationXYZ16 offset, LocationXYZ16 boundBoxSize, LocationXYZ16 boundBoxOffset)
 {
-    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
+    if (!paint_session_reserve_entry(session))
         return nullptr;
     auto g1 = gfx_get_g1_element(image_id & 0x7FFFF);
     if (g1 == nullptr)
@@ -191,6 +225,7 @@ static paint_struct* sub_9819_c(
  */
 void paint_session_generate(paint_session* session)
 {
+    Profiler::ScopedTimer profilerScope("paint_session_generate");
     rct_drawpixelinfo* dpi = session->DPI;
     LocationXY16 mapTile = { (int16_t)(dpi->x & 0xFFE0), (int16_t)((dpi->y - 16) & 0xFFE0) };
 
@@ -297,6 +332,8 @@ void paint_session_generate(paint_session* session)
     }
 }
 
+// The comparisons are combined without short circuiting, the sort calls these for every pair of neighbouring structs
+// and the branches are hard to predict
 template<uint8_t>
 static bool check_bounding_box(const paint_struct_bound_box& initialBBox, const paint_struct_bound_box& currentBBox)
 {
@@ -305,42 +342,26 @@ static bool check_bounding_box(const paint_struct_bound_box& initialBBox, const
 
 template<> bool check_bounding_box<0>(const paint_struct_bound_box& initialBBox, const paint_struct_bound_box& currentBBox)
 {
-    if (initialBBox.z_end >= currentBBox.z && initialBBox.y_end >= currentBBox.y && initialBBox.x_end >= currentBBox.x
-        && !(initialBBox.z < currentBBox.z_end && initialBBox.y < currentBBox.y_end && initialBBox.x < currentBBox.x_end))
-    {
-        return true;
-    }
-    return false;
+    return (initialBBox.z_end >= currentBBox.z) & (initialBBox.y_end >= currentBBox.y) & (initialBBox.x_end >= currentBBox.x)
+        & !((initialBBox.z < currentBBox.z_end) & (initialBBox.y < currentBBox.y_end) & (initialBBox.x < currentBBox.x_end));
 }
 
 template<> bool check_bounding_box<1>(const paint_struct_bound_box& initialBBox, const paint_struct_bound_box& currentBBox)
 {
-    if (initialBBox.z_end >= currentBBox.z && initialBBox.y_end >= currentBBox.y && initialBBox.x_end < currentBBox.x
-        && !(initialBBox.z < currentBBox.z_end && initialBBox.y < currentBBox.y_end && initialBBox.x >= currentBBox.x_end))
-    {
-        return true;
-    }
-    return false;
+    return (initialBBox.z_end >= currentBBox.z) & (initialBBox.y_end >= currentBBox.y) & (initialBBox.x_end < currentBBox.x)
+        & !((initialBBox.z < currentBBox.z_end) & (initialBBox.y < currentBBox.y_end) & (initialBBox.x >= currentBBox.x_end));
 }
 
 template<> bool check_bounding_box<2>(const paint_struct_bound_box& initialBBox, const paint_struct_bound_box& currentBBox)
 {
-    if (initialBBox.z_end >= currentBBox.z && initialBBox.y_end < currentBBox.y && initialBBox.x_end < currentBBox.x
-        && !(initialBBox.z < currentBBox.z_end && initialBBox.y >= currentBBox.y_end && initialBBox.x >= currentBBox.x_end))
-    {
-        return true;
-    }
-    return false;
+    return (initialBBox.z_end >= currentBBox.z) & (initialBBox.y_end < currentBBox.y) & (initialBBox.x_end < currentBBox.x)
+        & !((initialBBox.z < currentBBox.z_end) & (initialBBox.y >= currentBBox.y_end) & (initialBBox.x >= currentBBox.x_end));
 }
 
 template<> bool check_bounding_box<3>(const paint_struct_bound_box& initialBBox, const paint_struct_bound_box& currentBBox)
 {
-    if (initialBBox.z_end >= currentBBox.z && initialBBox.y_end < currentBBox.y && initialBBox.x_end >= currentBBox.x
-        && !(initialBBox.z < currentBBox.z_end && initialBBox.y >= currentBBox.y_end && initialBBox.x < currentBBox.x_end))
-    {
-        return true;
-    }
-    return false;
+    return (initialBBox.z_end >= currentBBox.z) & (initialBBox.y_end < currentBBox.y) & (initialBBox.x_end >= currentBBox.x)
+        & !((initialBBox.z < currentBBox.z_end) & (initialBBox.y >= currentBBox.y_end) & (initialBBox.x < currentBBox.x_end));
 }
 
 template<uint8_t _TRotation>
@@ -451,6 +472,7 @@ paint_struct* paint_arrange_structs_helper(paint_struct* ps_next, uint16_t quadr
  */
 paint_struct paint_session_arrange(paint_session* session)
 {
+    Profiler::ScopedTimer profilerScope("paint_session_arrange");
     paint_struct psHead = {};
     paint_struct* ps = &psHead;
     ps->next_quadrant_ps = nullptr;
@@ -492,6 +514,7 @@ paint_struct paint_session_arrange(paint_session* session)
  */
 void paint_draw_structs(rct_drawpixelinfo* dpi, paint_struct* ps, uint32_t viewFlags)
 {
+    Profiler::ScopedTimer profilerScope("paint_draw_structs");
     paint_struct* previous_ps = ps->next_quadrant_ps;
     for (ps = ps->next_quadrant_ps; ps;)
     {
@@ -723,18 +746,29 @@ static void draw_pixel_info_crop_by_zoom(rct_drawpixelinfo* dpi)
 
 paint_session* paint_session_alloc(rct_drawpixelinfo* dpi)
 {
-    // Currently limited to just one session at a time
-    assert(!_paintSessionInUse);
-    _paintSessionInUse = true;
-    paint_session* session = &gPaintSession;
+    paint_session* session = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_paintSessionPoolMutex);
+        if (!_freePaintSessions.empty())
+        {
+            session = _freePaintSessions.back();
+            _freePaintSessions.pop_back();
+        }
+        else
+        {
+            _paintSessionPool.push_back(std::make_unique<paint_session>());
+            session = _paintSessionPool.back().get();
+        }
+    }
 
     paint_session_init(session, dpi);
     return session;
 }
 
-void paint_session_free([[maybe_unused]] paint_session* session)
+void paint_session_free(paint_session* session)
 {
-    _paintSessionInUse = false;
+    std::lock_guard<std::mutex> lock(_paintSessionPoolMutex);
+    _freePaintSessions.push_back(session);
 }
 
 /**
@@ -759,7 +793,7 @@ paint_struct* sub_98196C(
     session->UnkF1AD28 = nullptr;
     session->UnkF1AD2C = nullptr;
 
-    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
+    if (!paint_session_reserve_entry(session))
     {
         return nullptr;
     }
@@ -1048,7 +1082,7 @@ bool paint_attach_to_previous_attach(paint_session* session, uint32_t image_id,
         return paint_attach_to_previous_ps(session, image_id, x, y);
     }
 
-    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
+    if (!paint_session_reserve_entry(session))
     {
         return false;
     }
@@ -1080,7 +1114,7 @@ bool paint_attach_to_previous_attach(paint_session* session, uint32_t image_id,
  */
 bool paint_attach_to_previous_ps(paint_session* session, uint32_t image_id, uint16_t x, uint16_t y)
 {
-    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
+    if (!paint_session_reserve_entry(session))
     {
         return false;
     }
@@ -1123,7 +1157,7 @@ void paint_floating_money_effect(
     paint_session* session, money32 amount, rct_string_id string_id, int16_t y, int16_t z, int8_t y_offsets[], int16_t offset_x,
     uint32_t rotation)
 {
-    if (session->NextFreePaintStruct >= session->EndOfPaintStructArray)
+    if (!paint_session_reserve_entry(session))
     {
         return;
     }
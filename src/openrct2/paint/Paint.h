@@ -14,6 +14,10 @@
 #include "../interface/Colour.h"
 #include "../world/Location.hpp"
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 struct rct_tile_element;
 
 #pragma pack(push, 1)
@@ -137,10 +141,16 @@ struct tunnel_entry
 #define MAX_PAINT_QUADRANTS 512
 #define TUNNEL_MAX_COUNT 65
 
+// Paint structs are allocated in blocks, a new block is only started when the previous one is full so the addresses of
+// the structs already added stay valid
+#define PAINT_STRUCT_BLOCK_SIZE 4000
+#define PAINT_STRUCT_MAX_BLOCKS 64
+
 struct paint_session
 {
     rct_drawpixelinfo* DPI;
-    paint_entry PaintStructs[4000];
+    std::vector<std::unique_ptr<paint_entry[]>> PaintStructBlocks;
+    size_t PaintStructBlockIndex;
     paint_struct* Quadrants[MAX_PAINT_QUADRANTS];
     uint32_t QuadrantBackIndex;
     uint32_t QuadrantFrontIndex;
@@ -173,7 +183,10 @@ struct paint_session
     uint32_t TrackColours[4];
 };
 
-extern paint_session gPaintSession;
+// Sign text is formatted through the shared format arguments and scrolling text cache, so painting it
+// has to be serialised when several paint sessions run at once. The same goes for drawing the string and
+// weather structs when several viewports are rendered at once.
+extern std::mutex gPaintTextMutex;
 
 // Globals for paint clipping
 extern uint8_t gClipHeight;
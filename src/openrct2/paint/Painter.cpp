@@ -13,6 +13,7 @@
 #include "../Intro.h"
 #include "../OpenRCT2.h"
 #include "../config/Config.h"
+#include "../core/Profiler.hpp"
 #include "../drawing/Drawing.h"
 #include "../drawing/IDrawingEngine.h"
 #include "../interface/Chat.h"
@@ -22,6 +23,8 @@
 #include "../title/TitleScreen.h"
 #include "../ui/UiContext.h"
 
+#include <algorithm>
+
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 using namespace OpenRCT2::Paint;
@@ -61,6 +64,10 @@ void Painter::Paint(IDrawingEngine& de)
     {
         PaintFPS(dpi);
     }
+    if (Profiler::IsEnabled())
+    {
+        PaintProfiler(dpi);
+    }
     gCurrentDrawCount++;
 }
 
@@ -90,6 +97,39 @@ void Painter::PaintFPS(rct_drawpixelinfo* dpi)
     gfx_set_dirty_blocks(x - 16, y - 4, gLastDrawStringX + 16, 16);
 }
 
+void Painter::PaintProfiler(rct_drawpixelinfo* dpi)
+{
+    constexpr int32_t left = 8;
+    constexpr int32_t top = 40;
+    constexpr int32_t lineHeight = 12;
+    constexpr int32_t timesOffset = 240;
+
+    utf8 buffer[128] = { 0 };
+    utf8* ch = buffer;
+    ch = utf8_write_codepoint(ch, FORMAT_MEDIUMFONT);
+    ch = utf8_write_codepoint(ch, FORMAT_OUTLINE);
+    ch = utf8_write_codepoint(ch, FORMAT_WHITE);
+    size_t remaining = sizeof(buffer) - (ch - buffer);
+
+    // Times of stages run on worker threads are summed, so children can add up to more than their parent
+    int32_t y = top;
+    int32_t right = left + timesOffset;
+    for (const auto& stage : Profiler::GetStageTimings())
+    {
+        snprintf(ch, remaining, "%s", stage.Name);
+        gfx_draw_string(dpi, buffer, 0, left + (stage.Depth * 8), y);
+
+        snprintf(ch, remaining, "%6.2f ms  peak %6.2f ms  x%u", stage.AverageMs, stage.PeakMs, stage.Calls);
+        gfx_draw_string(dpi, buffer, 0, left + timesOffset, y);
+        right = std::max<int32_t>(right, gLastDrawStringX);
+
+        y += lineHeight;
+    }
+
+    // Make area dirty so the text doesn't get drawn over the last
+    gfx_set_dirty_blocks(left - 4, top - 4, right + 16, y + 4);
+}
+
 void Painter::MeasureFPS()
 {
     _frames++;
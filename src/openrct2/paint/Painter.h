@@ -45,6 +45,7 @@ namespace OpenRCT2
 
         private:
             void PaintFPS(rct_drawpixelinfo* dpi);
+            void PaintProfiler(rct_drawpixelinfo* dpi);
             void MeasureFPS();
         };
     } // namespace Paint
@@ -34,8 +34,8 @@ void sprite_paint_setup(paint_session* session, const uint16_t x, const uint16_t
         return;
     }
 
-    uint16_t sprite_idx = sprite_get_first_in_quadrant(x, y);
-    if (sprite_idx == SPRITE_INDEX_NULL)
+    const auto& tileSprites = sprite_get_tile_sprites(x, y);
+    if (tileSprites.empty())
     {
         return;
     }
@@ -48,10 +48,9 @@ void sprite_paint_setup(paint_session* session, const uint16_t x, const uint16_t
 
     const bool highlightPathIssues = (gCurrentViewportFlags & VIEWPORT_FLAG_HIGHLIGHT_PATH_ISSUES);
 
-    for (const rct_sprite* spr = get_sprite(sprite_idx); sprite_idx != SPRITE_INDEX_NULL;
-         sprite_idx = spr->unknown.next_in_quadrant)
+    for (uint16_t sprite_idx : tileSprites)
     {
-        spr = get_sprite(sprite_idx);
+        const rct_sprite* spr = get_sprite(sprite_idx);
 
         if (highlightPathIssues)
         {
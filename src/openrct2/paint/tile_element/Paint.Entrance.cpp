@@ -21,8 +21,6 @@
 #include "../Supports.h"
 #include "Paint.TileElement.h"
 
-static uint32_t _unk9E32BC;
-
 /**
  *
  *  rct2: 0x0066508C, 0x00665540
@@ -87,13 +85,13 @@ static void ride_entrance_exit_paint(
     image_id = (colour_1 << 19) | (colour_2 << 24) | IMAGE_TYPE_REMAP | IMAGE_TYPE_REMAP_2_PLUS;
 
     session->InteractionType = VIEWPORT_INTERACTION_ITEM_RIDE;
-    _unk9E32BC = 0;
+    uint32_t supportImageId = 0;
 
     if (tile_element->flags & TILE_ELEMENT_FLAG_GHOST)
     {
         session->InteractionType = VIEWPORT_INTERACTION_ITEM_NONE;
         image_id = CONSTRUCTION_MARKER;
-        _unk9E32BC = image_id;
+        supportImageId = image_id;
         if (transparant_image_id)
             transparant_image_id = image_id;
     }
@@ -157,6 +155,7 @@ static void ride_entrance_exit_paint(
 
     if (!is_exit && !(tile_element->flags & TILE_ELEMENT_FLAG_GHOST) && tile_element->properties.entrance.ride_index != 0xFF)
     {
+        std::lock_guard<std::mutex> textLock(gPaintTextMutex);
         set_format_arg(0, uint32_t, 0);
         set_format_arg(4, uint32_t, 0);
 
@@ -190,7 +189,7 @@ static void ride_entrance_exit_paint(
             height + style->height, 2, 2, height + style->height);
     }
 
-    image_id = _unk9E32BC;
+    image_id = supportImageId;
     if (image_id == 0)
     {
         image_id = SPRITE_ID_PALETTE_COLOUR_1(COLOUR_SATURATED_BROWN);
@@ -220,13 +219,11 @@ static void park_entrance_paint(paint_session* session, uint8_t direction, int32
 #endif
 
     session->InteractionType = VIEWPORT_INTERACTION_ITEM_PARK;
-    _unk9E32BC = 0;
     uint32_t image_id, ghost_id = 0;
     if (tile_element->flags & TILE_ELEMENT_FLAG_GHOST)
     {
         session->InteractionType = VIEWPORT_INTERACTION_ITEM_NONE;
         ghost_id = CONSTRUCTION_MARKER;
-        _unk9E32BC = ghost_id;
     }
 
     // Index to which part of the entrance
@@ -266,6 +263,7 @@ static void park_entrance_paint(paint_session* session, uint8_t direction, int32
 
             {
                 rct_string_id park_text_id = STR_BANNER_TEXT_CLOSED;
+                std::lock_guard<std::mutex> textLock(gPaintTextMutex);
                 set_format_arg(0, uint32_t, 0);
                 set_format_arg(4, uint32_t, 0);
 
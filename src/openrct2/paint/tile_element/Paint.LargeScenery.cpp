@@ -300,6 +300,7 @@ void large_scenery_paint(paint_session* session, uint8_t direction, uint16_t hei
         }
         // 6B8331:
         // Draw sign text:
+        std::lock_guard<std::mutex> textLock(gPaintTextMutex);
         set_format_arg(0, uint32_t, 0);
         set_format_arg(4, uint32_t, 0);
         int32_t textColour = scenery_large_get_secondary_colour(tileElement);
@@ -412,6 +413,7 @@ void large_scenery_paint(paint_session* session, uint8_t direction, uint16_t hei
         return;
     }
     // Draw scrolling text:
+    std::lock_guard<std::mutex> textLock(gPaintTextMutex);
     set_format_arg(0, uint32_t, 0);
     set_format_arg(4, uint32_t, 0);
     uint8_t textColour = scenery_large_get_secondary_colour(tileElement);
@@ -410,6 +410,7 @@ void fence_paint(paint_session* session, uint8_t direction, int32_t height, cons
         return;
     }
 
+    std::lock_guard<std::mutex> textLock(gPaintTextMutex);
     set_format_arg(0, uint32_t, 0);
     set_format_arg(4, uint32_t, 0);
 
@@ -1610,26 +1610,9 @@ void rct_peep::PickRideToGoOn()
     else
     {
         // Take nearby rides into consideration
-        int32_t cx = floor2(x, 32);
-        int32_t cy = floor2(y, 32);
-        for (int32_t tileX = cx - 320; tileX <= cx + 320; tileX += 32)
-        {
-            for (int32_t tileY = cy - 320; tileY <= cy + 320; tileY += 32)
-            {
-                if (tileX >= 0 && tileY >= 0 && tileX < (256 * 32) && tileY < (256 * 32))
-                {
-                    rct_tile_element* tileElement = map_get_first_element_at(tileX >> 5, tileY >> 5);
-                    do
-                    {
-                        if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
-                            continue;
-
-                        int32_t rideIndex = track_element_get_ride_index(tileElement);
-                        rideConsideration[rideIndex >> 5] |= (1u << (rideIndex & 0x1F));
-                    } while (!(tileElement++)->IsLastForTile());
-                }
-            }
-        }
+        int32_t tileX = x >> 5;
+        int32_t tileY = y >> 5;
+        map_get_rides_in_range(tileX - 10, tileY - 10, tileX + 10, tileY + 10, rideConsideration);
 
         // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
         int32_t i;
@@ -2694,95 +2677,61 @@ static uint8_t peep_assess_surroundings(int16_t centre_x, int16_t centre_y, int1
     if ((tile_element_height(centre_x, centre_y) & 0xFFFF) > centre_z)
         return PEEP_THOUGHT_TYPE_NONE;
 
-    uint16_t num_scenery = 0;
-    uint16_t num_fountains = 0;
-    uint16_t nearby_music = 0;
-    uint16_t num_rubbish = 0;
+    // The tiles within 5 tiles west / north and 4 tiles east / south of the centre
+    int32_t centreTileX = centre_x / 32;
+    int32_t centreTileY = centre_y / 32;
+    MapSurroundings surroundings = map_get_surroundings(centreTileX - 5, centreTileY - 5, centreTileX + 4, centreTileY + 4);
+    if (surroundings.HasInvalidPathItem)
+        return PEEP_THOUGHT_TYPE_NONE;
 
-    int16_t initial_x = std::max(centre_x - 160, 0);
-    int16_t initial_y = std::max(centre_y - 160, 0);
-    int16_t final_x = std::min(centre_x + 160, 8192);
-    int16_t final_y = std::min(centre_y + 160, 8192);
+    uint16_t num_scenery = surroundings.NumScenery;
+    uint16_t num_fountains = surroundings.NumFountains;
+    uint16_t nearby_music = 0;
+    uint16_t num_rubbish = surroundings.NumBrokenPathItems;
 
-    for (int16_t x = initial_x; x < final_x; x += 32)
+    uint32_t nearbyRides[8]{};
+    map_get_rides_in_range(centreTileX - 5, centreTileY - 5, centreTileX + 4, centreTileY + 4, nearbyRides);
+    for (int32_t i = 0; i < MAX_RIDES; i++)
     {
-        for (int16_t y = initial_y; y < final_y; y += 32)
-        {
-            rct_tile_element* tileElement = map_get_first_element_at(x / 32, y / 32);
+        if (!(nearbyRides[i >> 5] & (1u << (i & 0x1F))))
+            continue;
 
-            do
+        Ride* ride = get_ride(i);
+        if (ride->lifecycle_flags & RIDE_LIFECYCLE_MUSIC && ride->status != RIDE_STATUS_CLOSED
+            && !(ride->lifecycle_flags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_CRASHED)))
+        {
+            if (ride->type == RIDE_TYPE_MERRY_GO_ROUND || ride->music == MUSIC_STYLE_ORGAN)
             {
-                Ride* ride;
-                rct_scenery_entry* scenery;
-
-                switch (tileElement->GetType())
-                {
-                    case TILE_ELEMENT_TYPE_PATH:
-                        if (!footpath_element_has_path_scenery(tileElement))
-                            break;
-
-                        scenery = get_footpath_item_entry(footpath_element_get_path_scenery_index(tileElement));
-                        if (scenery == nullptr)
-                        {
-                            return PEEP_THOUGHT_TYPE_NONE;
-                        }
-                        if (footpath_element_path_scenery_is_ghost(tileElement))
-                            break;
-
-                        if (scenery->path_bit.flags
-                            & (PATH_BIT_FLAG_JUMPING_FOUNTAIN_WATER | PATH_BIT_FLAG_JUMPING_FOUNTAIN_SNOW))
-                        {
-                            num_fountains++;
-                            break;
-                        }
-                        if (tileElement->flags & TILE_ELEMENT_FLAG_BROKEN)
-                        {
-                            num_rubbish++;
-                        }
-                        break;
-                    case TILE_ELEMENT_TYPE_LARGE_SCENERY:
-                    case TILE_ELEMENT_TYPE_SMALL_SCENERY:
-                        num_scenery++;
-                        break;
-                    case TILE_ELEMENT_TYPE_TRACK:
-                        ride = get_ride(track_element_get_ride_index(tileElement));
-                        if (ride->lifecycle_flags & RIDE_LIFECYCLE_MUSIC && ride->status != RIDE_STATUS_CLOSED
-                            && !(ride->lifecycle_flags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_CRASHED)))
-                        {
-                            if (ride->type == RIDE_TYPE_MERRY_GO_ROUND)
-                            {
-                                nearby_music |= 1;
-                                break;
-                            }
-
-                            if (ride->music == MUSIC_STYLE_ORGAN)
-                            {
-                                nearby_music |= 1;
-                                break;
-                            }
-
-                            if (ride->type == RIDE_TYPE_DODGEMS)
-                            {
-                                // Dodgems drown out music?
-                                nearby_music |= 2;
-                            }
-                        }
-                        break;
-                }
-            } while (!(tileElement++)->IsLastForTile());
+                nearby_music |= 1;
+            }
+            else if (ride->type == RIDE_TYPE_DODGEMS)
+            {
+                // Dodgems drown out music?
+                nearby_music |= 2;
+            }
         }
     }
 
-    rct_litter* litter;
-    for (uint16_t sprite_idx = gSpriteListHead[SPRITE_LIST_LITTER]; sprite_idx != SPRITE_INDEX_NULL; sprite_idx = litter->next)
+    // Litter within 160 units in either direction, which can be up to 5 tiles away on each side
+    for (int32_t tileX = std::max(centreTileX - 5, 0); tileX <= std::min(centreTileX + 5, MAXIMUM_MAP_SIZE_TECHNICAL - 1);
+         tileX++)
     {
-        litter = &(get_sprite(sprite_idx)->litter);
-
-        int16_t dist_x = abs(litter->x - centre_x);
-        int16_t dist_y = abs(litter->y - centre_y);
-        if (std::max(dist_x, dist_y) <= 160)
+        for (int32_t tileY = std::max(centreTileY - 5, 0);
+             tileY <= std::min(centreTileY + 5, MAXIMUM_MAP_SIZE_TECHNICAL - 1); tileY++)
         {
-            num_rubbish++;
+            for (uint16_t spriteIndex : sprite_get_tile_sprites(tileX * 32, tileY * 32))
+            {
+                rct_sprite* sprite = get_sprite(spriteIndex);
+                if (sprite->unknown.sprite_identifier != SPRITE_IDENTIFIER_LITTER)
+                    continue;
+
+                int16_t dist_x = abs(sprite->litter.x - centre_x);
+                int16_t dist_y = abs(sprite->litter.y - centre_y);
+                if (std::max(dist_x, dist_y) <= 160)
+                {
+                    num_rubbish++;
+                }
+            }
         }
     }
 
@@ -2943,28 +2892,19 @@ static void peep_head_for_nearest_ride_type(rct_peep* peep, int32_t rideType)
     else
     {
         // Take nearby rides into consideration
-        int32_t cx = floor2(peep->x, 32);
-        int32_t cy = floor2(peep->y, 32);
-        for (int32_t x = cx - 320; x <= cx + 320; x += 32)
+        int32_t tileX = peep->x >> 5;
+        int32_t tileY = peep->y >> 5;
+        uint32_t nearbyRides[8]{};
+        map_get_rides_in_range(tileX - 10, tileY - 10, tileX + 10, tileY + 10, nearbyRides);
+        for (int32_t i = 0; i < MAX_RIDES; i++)
         {
-            for (int32_t y = cy - 320; y <= cy + 320; y += 32)
-            {
-                if (x >= 0 && y >= 0 && x < (256 * 32) && y < (256 * 32))
-                {
-                    rct_tile_element* tileElement = map_get_first_element_at(x >> 5, y >> 5);
-                    do
-                    {
-                        if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
-                            continue;
+            if (!(nearbyRides[i >> 5] & (1u << (i & 0x1F))))
+                continue;
 
-                        int32_t rideIndex = track_element_get_ride_index(tileElement);
-                        ride = get_ride(rideIndex);
-                        if (ride->type == rideType)
-                        {
-                            rideConsideration[rideIndex >> 5] |= (1u << (rideIndex & 0x1F));
-                        }
-                    } while (!(tileElement++)->IsLastForTile());
-                }
+            ride = get_ride(i);
+            if (ride->type == rideType)
+            {
+                rideConsideration[i >> 5] |= (1u << (i & 0x1F));
             }
         }
     }
@@ -3072,28 +3012,19 @@ static void peep_head_for_nearest_ride_with_flags(rct_peep* peep, int32_t rideTy
     else
     {
         // Take nearby rides into consideration
-        int32_t cx = floor2(peep->x, 32);
-        int32_t cy = floor2(peep->y, 32);
-        for (int32_t x = cx - 320; x <= cx + 320; x += 32)
+        int32_t tileX = peep->x >> 5;
+        int32_t tileY = peep->y >> 5;
+        uint32_t nearbyRides[8]{};
+        map_get_rides_in_range(tileX - 10, tileY - 10, tileX + 10, tileY + 10, nearbyRides);
+        for (int32_t i = 0; i < MAX_RIDES; i++)
         {
-            for (int32_t y = cy - 320; y <= cy + 320; y += 32)
-            {
-                if (x >= 0 && y >= 0 && x < (256 * 32) && y < (256 * 32))
-                {
-                    rct_tile_element* tileElement = map_get_first_element_at(x >> 5, y >> 5);
-                    do
-                    {
-                        if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
-                            continue;
+            if (!(nearbyRides[i >> 5] & (1u << (i & 0x1F))))
+                continue;
 
-                        int32_t rideIndex = track_element_get_ride_index(tileElement);
-                        ride = get_ride(rideIndex);
-                        if (ride_type_has_flag(ride->type, rideTypeFlags))
-                        {
-                            rideConsideration[rideIndex >> 5] |= (1u << (rideIndex & 0x1F));
-                        }
-                    } while (!(tileElement++)->IsLastForTile());
-                }
+            ride = get_ride(i);
+            if (ride_type_has_flag(ride->type, rideTypeFlags))
+            {
+                rideConsideration[i >> 5] |= (1u << (i & 0x1F));
             }
         }
     }
@@ -5347,10 +5278,9 @@ void rct_peep::UpdateWalking()
         return;
 
     // Check if there is a peep watching (and if there is place for us)
-    uint16_t sprite_id = sprite_get_first_in_quadrant(x, y);
-    for (rct_sprite* sprite; sprite_id != SPRITE_INDEX_NULL; sprite_id = sprite->unknown.next_in_quadrant)
+    for (uint16_t sprite_id : sprite_get_tile_sprites(x, y))
     {
-        sprite = get_sprite(sprite_id);
+        rct_sprite* sprite = get_sprite(sprite_id);
 
         if (sprite->unknown.linked_list_type_offset != SPRITE_LIST_PEEP * 2)
             continue;
@@ -5942,13 +5872,12 @@ bool rct_peep::UpdateWalkingFindBench()
     for (; !(edges & (1 << chosen_edge));)
         chosen_edge = (chosen_edge + 1) & 0x3;
 
-    uint16_t sprite_id = sprite_get_first_in_quadrant(x, y);
     uint8_t free_edge = 3;
 
     // Check if there is no peep sitting in chosen_edge
-    for (rct_sprite* sprite; sprite_id != SPRITE_INDEX_NULL; sprite_id = sprite->unknown.next_in_quadrant)
+    for (uint16_t sprite_id : sprite_get_tile_sprites(x, y))
     {
-        sprite = get_sprite(sprite_id);
+        rct_sprite* sprite = get_sprite(sprite_id);
 
         if (sprite->unknown.linked_list_type_offset != SPRITE_LIST_PEEP * 2)
             continue;
@@ -6133,12 +6062,10 @@ static void peep_update_walking_break_scenery(rct_peep* peep)
     if (edges == 0xF)
         return;
 
-    uint16_t sprite_id = sprite_get_first_in_quadrant(peep->x, peep->y);
-
     // Check if a peep is already sitting on the bench. If so, do not vandalise it.
-    for (rct_sprite* sprite; sprite_id != SPRITE_INDEX_NULL; sprite_id = sprite->unknown.next_in_quadrant)
+    for (uint16_t sprite_id : sprite_get_tile_sprites(peep->x, peep->y))
     {
-        sprite = get_sprite(sprite_id);
+        rct_sprite* sprite = get_sprite(sprite_id);
 
         if ((sprite->unknown.linked_list_type_offset != SPRITE_LIST_PEEP * 2) || (sprite->peep.state != PEEP_STATE_SITTING)
             || (peep->z != sprite->peep.z))
@@ -6168,6 +6095,7 @@ static void peep_update_walking_break_scenery(rct_peep* peep)
     }
 
     tileElement->flags |= TILE_ELEMENT_FLAG_BROKEN;
+    map_invalidate_tile_indices_at(peep->next_x / 32, peep->next_y / 32);
 
     map_invalidate_tile_zoom1(peep->next_x, peep->next_y, (tileElement->base_height << 3) + 32, tileElement->base_height << 3);
 
@@ -15,7 +15,11 @@
 #include "../world/Footpath.h"
 #include "Peep.h"
 
+#include <algorithm>
 #include <cstring>
+#include <iterator>
+#include <unordered_map>
+#include <vector>
 
 static bool _peepPathFindIsStaff;
 static int8_t _peepPathFindNumJunctions;
@@ -23,6 +27,122 @@ static int8_t _peepPathFindMaxJunctions;
 static int32_t _peepPathFindTilesChecked;
 static uint8_t _peepPathFindFewestNumSteps;
 
+/* Results of the heuristic search for guests. A search only depends on the
+ * map, the goal, the search limits and the peep's pathfind history, so
+ * guests at the same junction heading for the same goal can share one.
+ * The whole cache is dropped whenever anything that could affect a search
+ * changes, see peep_pathfind_invalidate_cache(). */
+struct PathfindSearchKey
+{
+    int32_t x, y, z;
+    int32_t goalX, goalY, goalZ;
+    int32_t tilesChecked;
+    uint8_t testEdge;
+    uint8_t maxJunctions;
+    uint8_t queueRideIndex;
+    bool ignoreForeignQueues;
+    rct12_xyzd8 history[4];
+
+    bool operator==(const PathfindSearchKey& rhs) const
+    {
+        if (x != rhs.x || y != rhs.y || z != rhs.z || goalX != rhs.goalX || goalY != rhs.goalY || goalZ != rhs.goalZ
+            || tilesChecked != rhs.tilesChecked || testEdge != rhs.testEdge || maxJunctions != rhs.maxJunctions
+            || queueRideIndex != rhs.queueRideIndex || ignoreForeignQueues != rhs.ignoreForeignQueues)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < std::size(history); i++)
+        {
+            if (history[i].x != rhs.history[i].x || history[i].y != rhs.history[i].y || history[i].z != rhs.history[i].z
+                || history[i].direction != rhs.history[i].direction)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+struct PathfindSearchKeyHash
+{
+    size_t operator()(const PathfindSearchKey& key) const
+    {
+        size_t hash = 0;
+        auto combine = [&hash](size_t value) { hash ^= value + 0x9E3779B9 + (hash << 6) + (hash >> 2); };
+        combine((key.x << 16) | (key.y << 8) | key.z);
+        combine((key.goalX << 16) | (key.goalY << 8) | key.goalZ);
+        combine(key.tilesChecked);
+        combine((key.testEdge << 24) | (key.maxJunctions << 16) | (key.queueRideIndex << 8) | key.ignoreForeignQueues);
+        for (const auto& history : key.history)
+        {
+            combine((history.x << 24) | (history.y << 16) | (history.z << 8) | history.direction);
+        }
+        return hash;
+    }
+};
+
+struct PathfindSearchResult
+{
+    uint16_t score;
+    uint8_t steps;
+};
+
+// Limits the memory used by the cache when the map does not change for a long time
+constexpr size_t PATHFIND_CACHE_MAX_ENTRIES = 65536;
+// Limits the memory used by nodes left behind when single tiles are rebuilt
+constexpr size_t PATHFIND_NODES_MAX_ENTRIES = 1 << 20;
+
+static std::unordered_map<PathfindSearchKey, PathfindSearchResult, PathfindSearchKeyHash> _peepPathFindCache;
+
+/* The elements the heuristic search can walk onto, i.e. paths, shops and
+ * entrances, reduced to the few fields the search reads. The nodes of a tile
+ * are built the first time a search visits it and kept in element order, so
+ * the search visits them exactly as it would walk the tile elements, without
+ * touching the surface, scenery and walls in between. Paths also remember
+ * their connected edges, with and without the no entry banners applied, and
+ * whether they are thin junctions, so the neighbouring tiles don't have to be
+ * looked at again. Invalidated along with the search result cache. */
+enum
+{
+    PATHFIND_NODE_PATH,
+    PATHFIND_NODE_SHOP,
+    PATHFIND_NODE_RIDE_ENTRANCE,
+    PATHFIND_NODE_RIDE_EXIT,
+    PATHFIND_NODE_PARK_ENTRANCE,
+};
+
+enum
+{
+    PATHFIND_NODE_FLAG_SLOPED = (1 << 0),
+    PATHFIND_NODE_FLAG_WIDE = (1 << 1),
+    PATHFIND_NODE_FLAG_QUEUE = (1 << 2),
+    PATHFIND_NODE_FLAG_JUNCTION_CHECKED = (1 << 3),
+    PATHFIND_NODE_FLAG_THIN_JUNCTION = (1 << 4),
+};
+
+struct PathfindNode
+{
+    rct_tile_element* element;
+    uint8_t type;
+    uint8_t baseHeight;
+    uint8_t direction; // Entrance direction or path slope direction
+    uint8_t flags;
+    uint8_t edges;
+    uint8_t guestEdges; // Edges that are not closed by a no entry banner
+    uint8_t rideIndex;
+};
+
+struct PathfindTileNodes
+{
+    uint32_t generation;
+    uint32_t first;
+    uint32_t count;
+};
+
+static PathfindTileNodes _peepPathFindTileNodes[MAXIMUM_MAP_SIZE_TECHNICAL * MAXIMUM_MAP_SIZE_TECHNICAL];
+static std::vector<PathfindNode> _peepPathFindNodes;
+static uint32_t _peepPathFindNodesGeneration = 1;
+
 static int32_t guest_surface_path_finding(rct_peep* peep);
 
 /* A junction history for the peep pathfinding heuristic search
@@ -100,6 +220,112 @@ static int32_t path_get_permitted_edges(rct_tile_element* tileElement)
     return banner_clear_path_edges(tileElement, tileElement->properties.path.edges) & 0x0F;
 }
 
+static void pathfind_build_tile_nodes(int32_t x, int32_t y, PathfindTileNodes* tileNodes)
+{
+    tileNodes->generation = _peepPathFindNodesGeneration;
+    tileNodes->first = (uint32_t)_peepPathFindNodes.size();
+
+    rct_tile_element* tileElement = map_get_first_element_at(x, y);
+    do
+    {
+        if (tileElement->flags & TILE_ELEMENT_FLAG_GHOST)
+            continue;
+
+        PathfindNode node = {};
+        node.element = tileElement;
+        node.baseHeight = tileElement->base_height;
+        switch (tileElement->GetType())
+        {
+            case TILE_ELEMENT_TYPE_TRACK:
+            {
+                node.rideIndex = track_element_get_ride_index(tileElement);
+                Ride* ride = get_ride(node.rideIndex);
+                if (!ride_type_has_flag(ride->type, RIDE_TYPE_FLAG_IS_SHOP))
+                    continue;
+                node.type = PATHFIND_NODE_SHOP;
+                break;
+            }
+            case TILE_ELEMENT_TYPE_ENTRANCE:
+                node.direction = tile_element_get_direction(tileElement);
+                node.rideIndex = tileElement->properties.entrance.ride_index;
+                switch (tileElement->properties.entrance.type)
+                {
+                    case ENTRANCE_TYPE_RIDE_ENTRANCE:
+                        node.type = PATHFIND_NODE_RIDE_ENTRANCE;
+                        break;
+                    case ENTRANCE_TYPE_RIDE_EXIT:
+                        node.type = PATHFIND_NODE_RIDE_EXIT;
+                        break;
+                    case ENTRANCE_TYPE_PARK_ENTRANCE:
+                        node.type = PATHFIND_NODE_PARK_ENTRANCE;
+                        break;
+                    default:
+                        continue;
+                }
+                break;
+            case TILE_ELEMENT_TYPE_PATH:
+            {
+                node.type = PATHFIND_NODE_PATH;
+                node.rideIndex = tileElement->properties.path.ride_index;
+                if (footpath_element_is_sloped(tileElement))
+                {
+                    node.flags |= PATHFIND_NODE_FLAG_SLOPED;
+                    node.direction = footpath_element_get_slope_direction(tileElement);
+                }
+                if (footpath_element_is_wide(tileElement))
+                    node.flags |= PATHFIND_NODE_FLAG_WIDE;
+                if (footpath_element_is_queue(tileElement))
+                    node.flags |= PATHFIND_NODE_FLAG_QUEUE;
+                node.edges = footpath_get_edges(tileElement);
+
+                int32_t guestEdges = tileElement->properties.path.edges;
+                for (rct_tile_element* bannerElement = get_banner_on_path(tileElement); bannerElement != nullptr;
+                     bannerElement = get_banner_on_path(bannerElement))
+                {
+                    guestEdges &= bannerElement->properties.banner.flags;
+                }
+                node.guestEdges = guestEdges & 0x0F;
+                break;
+            }
+            default:
+                continue;
+        }
+        _peepPathFindNodes.push_back(node);
+    } while (!(tileElement++)->IsLastForTile());
+
+    tileNodes->count = (uint32_t)_peepPathFindNodes.size() - tileNodes->first;
+}
+
+/**
+ * Gets the pathfinding nodes of a tile, building them if the tile has not been visited since the last map change.
+ * Returns nullptr for tiles outside the map.
+ */
+static const PathfindTileNodes* pathfind_get_tile_nodes(int32_t x, int32_t y)
+{
+    if (x < 0 || y < 0 || x >= MAXIMUM_MAP_SIZE_TECHNICAL || y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+        return nullptr;
+
+    PathfindTileNodes* tileNodes = &_peepPathFindTileNodes[y * MAXIMUM_MAP_SIZE_TECHNICAL + x];
+    if (tileNodes->generation != _peepPathFindNodesGeneration)
+    {
+        pathfind_build_tile_nodes(x, y, tileNodes);
+    }
+    return tileNodes;
+}
+
+static bool pathfind_node_is_valid_z_and_direction(const PathfindNode& node, int32_t currentZ, int32_t currentDirection)
+{
+    if (node.flags & PATHFIND_NODE_FLAG_SLOPED)
+    {
+        if (node.direction == currentDirection)
+            return currentZ == node.baseHeight;
+        if ((node.direction ^ 2) != currentDirection)
+            return false;
+        return currentZ == node.baseHeight + 2;
+    }
+    return currentZ == node.baseHeight;
+}
+
 /**
  *
  *  rct2: 0x0069524E
@@ -505,6 +731,18 @@ static bool path_is_thin_junction(rct_tile_element* path, TileCoordsXYZ loc)
     return thin_junction;
 }
 
+static bool pathfind_node_is_thin_junction(uint32_t nodeIndex, TileCoordsXYZ loc)
+{
+    PathfindNode& node = _peepPathFindNodes[nodeIndex];
+    if (!(node.flags & PATHFIND_NODE_FLAG_JUNCTION_CHECKED))
+    {
+        node.flags |= PATHFIND_NODE_FLAG_JUNCTION_CHECKED;
+        if (path_is_thin_junction(node.element, loc))
+            node.flags |= PATHFIND_NODE_FLAG_THIN_JUNCTION;
+    }
+    return (node.flags & PATHFIND_NODE_FLAG_THIN_JUNCTION) != 0;
+}
+
 /**
  * Searches for the tile with the best heuristic score within the search limits
  * starting from the given tile x,y,z and going in the given direction test_edge.
@@ -633,76 +871,68 @@ static void peep_pathfind_heuristic_search(
 
     /* Get the next map element of interest in the direction of test_edge. */
     bool found = false;
-    rct_tile_element* tileElement = map_get_first_element_at(loc.x, loc.y);
-    if (tileElement == nullptr)
+    const PathfindTileNodes* tileNodes = pathfind_get_tile_nodes(loc.x, loc.y);
+    if (tileNodes == nullptr)
     {
         return;
     }
-    do
+    const uint32_t firstNode = tileNodes->first;
+    const uint32_t lastNode = tileNodes->first + tileNodes->count;
+    for (uint32_t nodeIndex = firstNode; nodeIndex < lastNode; nodeIndex++)
     {
         /* Look for all map elements that the peep could walk onto while
          * navigating to the goal, including the goal tile. */
 
-        if (tileElement->flags & TILE_ELEMENT_FLAG_GHOST)
-            continue;
+        // Copied as the recursive search below may add nodes, moving the others
+        const PathfindNode node = _peepPathFindNodes[nodeIndex];
+        rct_tile_element* tileElement = node.element;
 
-        uint8_t rideIndex = 0xFF;
-        switch (tileElement->GetType())
+        [[maybe_unused]] uint8_t rideIndex = 0xFF;
+        switch (node.type)
         {
-            case TILE_ELEMENT_TYPE_TRACK:
-            {
-                if (loc.z != tileElement->base_height)
+            case PATHFIND_NODE_SHOP:
+                if (loc.z != node.baseHeight)
                     continue;
                 /* For peeps heading for a shop, the goal is the shop
                  * tile. */
-                rideIndex = track_element_get_ride_index(tileElement);
-                Ride* ride = get_ride(rideIndex);
-                if (ride_type_has_flag(ride->type, RIDE_TYPE_FLAG_IS_SHOP))
-                {
-                    found = true;
-                    searchResult = PATH_SEARCH_SHOP_ENTRANCE;
-                    break;
-                }
-                else
-                {
-                    continue;
-                }
-            }
-            case TILE_ELEMENT_TYPE_ENTRANCE:
-                if (loc.z != tileElement->base_height)
+                rideIndex = node.rideIndex;
+                found = true;
+                searchResult = PATH_SEARCH_SHOP_ENTRANCE;
+                break;
+            case PATHFIND_NODE_RIDE_ENTRANCE:
+            case PATHFIND_NODE_RIDE_EXIT:
+            case PATHFIND_NODE_PARK_ENTRANCE:
+                if (loc.z != node.baseHeight)
                     continue;
-                int32_t direction;
                 searchResult = PATH_SEARCH_OTHER;
-                switch (tileElement->properties.entrance.type)
+                switch (node.type)
                 {
-                    case ENTRANCE_TYPE_RIDE_ENTRANCE:
+                    case PATHFIND_NODE_RIDE_ENTRANCE:
                         /* For peeps heading for a ride without a queue, the
                          * goal is the ride entrance tile.
                          * For mechanics heading for the ride entrance
                          * (in the case when the station has no exit),
                          * the goal is the ride entrance tile. */
-                        direction = tile_element_get_direction(tileElement);
-                        if (direction == test_edge)
+                        if (node.direction == test_edge)
                         {
                             /* The rideIndex will be useful for
                              * adding transport rides later. */
-                            rideIndex = tileElement->properties.entrance.ride_index;
+                            rideIndex = node.rideIndex;
                             searchResult = PATH_SEARCH_RIDE_ENTRANCE;
                             found = true;
                             break;
                         }
                         continue; // Ride entrance is not facing the right direction.
-                    case ENTRANCE_TYPE_PARK_ENTRANCE:
+                    case PATHFIND_NODE_PARK_ENTRANCE:
                         /* For peeps leaving the park, the goal is the park
                          * entrance/exit tile. */
                         searchResult = PATH_SEARCH_PARK_EXIT;
                         found = true;
                         break;
-                    case ENTRANCE_TYPE_RIDE_EXIT:
+                    case PATHFIND_NODE_RIDE_EXIT:
                         /* For mechanics heading for the ride exit, the
                          * goal is the ride exit tile. */
-                        direction = tile_element_get_direction(tileElement);
-                        if (direction == test_edge)
+                        if (node.direction == test_edge)
                         {
                             searchResult = PATH_SEARCH_RIDE_EXIT;
                             found = true;
@@ -713,19 +943,19 @@ static void peep_pathfind_heuristic_search(
                         continue;
                 }
                 break;
-            case TILE_ELEMENT_TYPE_PATH:
+            case PATHFIND_NODE_PATH:
             {
                 /* For peeps heading for a ride with a queue, the goal is the last
                  * queue path.
                  * Otherwise, peeps walk on path tiles to get to the goal. */
 
-                if (!is_valid_path_z_and_direction(tileElement, loc.z, test_edge))
+                if (!pathfind_node_is_valid_z_and_direction(node, loc.z, test_edge))
                     continue;
 
                 // Path may be sloped, so set z to path base height.
-                loc.z = tileElement->base_height;
+                loc.z = node.baseHeight;
 
-                if (footpath_element_is_wide(tileElement))
+                if (node.flags & PATHFIND_NODE_FLAG_WIDE)
                 {
                     /* Check if staff can ignore this wide flag. */
                     if (!staff_can_ignore_wide_flag(peep, loc.x * 32, loc.y * 32, loc.z, tileElement))
@@ -738,7 +968,7 @@ static void peep_pathfind_heuristic_search(
 
                 searchResult = PATH_SEARCH_THIN;
 
-                uint8_t numEdges = bitcount(footpath_get_edges(tileElement));
+                uint8_t numEdges = bitcount(node.edges);
 
                 if (numEdges < 2)
                 {
@@ -750,15 +980,14 @@ static void peep_pathfind_heuristic_search(
                 }
                 else
                 { // numEdges == 2
-                    if (footpath_element_is_queue(tileElement)
-                        && tileElement->properties.path.ride_index != gPeepPathFindQueueRideIndex)
+                    if ((node.flags & PATHFIND_NODE_FLAG_QUEUE) && node.rideIndex != gPeepPathFindQueueRideIndex)
                     {
-                        if (gPeepPathFindIgnoreForeignQueues && (tileElement->properties.path.ride_index != 0xFF))
+                        if (gPeepPathFindIgnoreForeignQueues && (node.rideIndex != 0xFF))
                         {
                             // Path is a queue we aren't interested in
                             /* The rideIndex will be useful for
                              * adding transport rides later. */
-                            rideIndex = tileElement->properties.path.ride_index;
+                            rideIndex = node.rideIndex;
                             searchResult = PATH_SEARCH_RIDE_QUEUE;
                         }
                     }
@@ -892,7 +1121,7 @@ static void peep_pathfind_heuristic_search(
         /* At this point the map element is a non-wide path.*/
 
         /* Get all the permitted_edges of the map element. */
-        uint8_t edges = path_get_permitted_edges(tileElement);
+        uint8_t edges = _peepPathFindIsStaff ? node.edges : node.guestEdges;
 
 #if defined(DEBUG_LEVEL_2) && DEBUG_LEVEL_2
         if (gPathFindDebug)
@@ -963,7 +1192,7 @@ static void peep_pathfind_heuristic_search(
         {
             /* Check if this is a thin junction. And perform additional
              * necessary checks. */
-            thin_junction = path_is_thin_junction(tileElement, loc);
+            thin_junction = pathfind_node_is_thin_junction(nodeIndex, loc);
 
             if (thin_junction)
             {
@@ -1087,7 +1316,7 @@ static void peep_pathfind_heuristic_search(
             uint8_t savedNumJunctions = _peepPathFindNumJunctions;
 
             uint8_t height = loc.z;
-            if (footpath_element_is_sloped(tileElement) && footpath_element_get_slope_direction(tileElement) == next_test_edge)
+            if ((node.flags & PATHFIND_NODE_FLAG_SLOPED) && node.direction == next_test_edge)
             {
                 height += 2;
             }
@@ -1129,8 +1358,7 @@ static void peep_pathfind_heuristic_search(
             }
 #endif // defined(DEBUG_LEVEL_2) && DEBUG_LEVEL_2
         } while ((next_test_edge = bitscanforward(edges)) != -1);
-
-    } while (!(tileElement++)->IsLastForTile());
+    }
 
     if (!found)
     {
@@ -1154,6 +1382,42 @@ static void peep_pathfind_heuristic_search(
     }
 }
 
+/**
+ * Forgets all cached search results and pathfinding nodes. Must be called whenever paths, entrances, shops or banners
+ * may have changed, or tile elements have been moved.
+ */
+void peep_pathfind_invalidate_cache()
+{
+    _peepPathFindCache.clear();
+    _peepPathFindNodes.clear();
+    if (++_peepPathFindNodesGeneration == 0)
+    {
+        // Tiles built in the previous use of the generations would appear to be up to date
+        std::fill(std::begin(_peepPathFindTileNodes), std::end(_peepPathFindTileNodes), PathfindTileNodes{});
+        _peepPathFindNodesGeneration = 1;
+    }
+}
+
+/**
+ * Forgets the pathfinding nodes of a single tile, keeping the cached search results. Enough when the elements of the
+ * tile have only been moved, e.g. when a ghost element that the search ignores is added or removed.
+ */
+void peep_pathfind_invalidate_tile(int32_t x, int32_t y)
+{
+    if (x < 0 || y < 0 || x >= MAXIMUM_MAP_SIZE_TECHNICAL || y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+        return;
+
+    // The old nodes of the tile stay in the list until the whole cache is dropped
+    if (_peepPathFindNodes.size() >= PATHFIND_NODES_MAX_ENTRIES)
+    {
+        peep_pathfind_invalidate_cache();
+        return;
+    }
+
+    // Generation 0 is never in use, so the tile is rebuilt the next time it is visited
+    _peepPathFindTileNodes[y * MAXIMUM_MAP_SIZE_TECHNICAL + x].generation = 0;
+}
+
 /**
  * Returns:
  *   -1   - no direction chosen
@@ -1414,9 +1678,54 @@ int32_t peep_pathfind_choose_direction(TileCoordsXYZ loc, rct_peep* peep)
             }
 #endif // defined(DEBUG_LEVEL_2) && DEBUG_LEVEL_2
 
-            peep_pathfind_heuristic_search(
-                { loc.x, loc.y, height }, peep, first_tile_element, inPatrolArea, 0, &score, test_edge, &endJunctions,
-                endJunctionList, endDirectionList, &endXYZ, &endSteps);
+            /* Staff searches also depend on their patrol area, so only
+             * the searches of guests are cached. */
+            bool useCache = peep->type == PEEP_TYPE_GUEST;
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+            // The cache does not keep the search path that is logged
+            useCache = useCache && !gPathFindDebug;
+#endif // defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+
+            PathfindSearchKey cacheKey;
+            auto cacheIt = _peepPathFindCache.end();
+            if (useCache)
+            {
+                cacheKey = { loc.x,
+                             loc.y,
+                             loc.z,
+                             goal.x,
+                             goal.y,
+                             goal.z,
+                             _peepPathFindTilesChecked,
+                             (uint8_t)test_edge,
+                             (uint8_t)_peepPathFindMaxJunctions,
+                             gPeepPathFindQueueRideIndex,
+                             gPeepPathFindIgnoreForeignQueues,
+                             { peep->pathfind_history[0], peep->pathfind_history[1], peep->pathfind_history[2],
+                               peep->pathfind_history[3] } };
+                cacheIt = _peepPathFindCache.find(cacheKey);
+            }
+
+            if (cacheIt != _peepPathFindCache.end())
+            {
+                score = cacheIt->second.score;
+                endSteps = cacheIt->second.steps;
+            }
+            else
+            {
+                peep_pathfind_heuristic_search(
+                    { loc.x, loc.y, height }, peep, first_tile_element, inPatrolArea, 0, &score, test_edge, &endJunctions,
+                    endJunctionList, endDirectionList, &endXYZ, &endSteps);
+
+                if (useCache)
+                {
+                    if (_peepPathFindCache.size() >= PATHFIND_CACHE_MAX_ENTRIES)
+                    {
+                        _peepPathFindCache.clear();
+                    }
+                    _peepPathFindCache[cacheKey] = { score, endSteps };
+                }
+            }
 
 #if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
             if (gPathFindDebug)
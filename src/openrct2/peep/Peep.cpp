@@ -421,19 +421,14 @@ int32_t peep_get_staff_count()
  */
 void peep_update_all()
 {
-    int32_t i;
-    uint16_t spriteIndex;
-    rct_peep* peep;
-
     if (gScreenFlags & (SCREEN_FLAGS_SCENARIO_EDITOR | SCREEN_FLAGS_TRACK_DESIGNER | SCREEN_FLAGS_TRACK_MANAGER))
         return;
 
-    spriteIndex = gSpriteListHead[SPRITE_LIST_PEEP];
-    i = 0;
-    while (spriteIndex != SPRITE_INDEX_NULL)
+    // Walk the peeps in sprite index order rather than the name sorted linked list, so that memory is accessed linearly
+    int32_t i = 0;
+    for (auto sprite : SpriteListRange(SPRITE_LIST_PEEP))
     {
-        peep = &(get_sprite(spriteIndex)->peep);
-        spriteIndex = peep->next;
+        rct_peep* peep = &sprite->peep;
 
         if ((uint32_t)(i & 0x7F) != (gCurrentTicks & 0x7F))
         {
@@ -955,6 +950,7 @@ void peep_sprite_remove(rct_peep* peep)
         peep->type = 0xFF;
         staff_update_greyed_patrol_areas();
         peep->type = PEEP_TYPE_STAFF;
+        staff_invalidate_type_lists();
 
         news_item_disable_news(NEWS_ITEM_PEEP, peep->sprite_index);
     }
@@ -2774,10 +2770,9 @@ static void peep_footpath_move_forward(rct_peep* peep, int16_t x, int16_t y, rct
     uint16_t crowded = 0;
     uint8_t litter_count = 0;
     uint8_t sick_count = 0;
-    uint16_t sprite_id = sprite_get_first_in_quadrant(x, y);
-    for (rct_sprite* sprite; sprite_id != SPRITE_INDEX_NULL; sprite_id = sprite->unknown.next_in_quadrant)
+    for (uint16_t sprite_id : sprite_get_tile_sprites(x, y))
     {
-        sprite = get_sprite(sprite_id);
+        rct_sprite* sprite = get_sprite(sprite_id);
         if (sprite->unknown.sprite_identifier == SPRITE_IDENTIFIER_PEEP)
         {
             rct_peep* other_peep = (rct_peep*)sprite;
@@ -3316,14 +3311,11 @@ static void peep_apply_easter_egg_to_nearby_guests(rct_peep* peep, easter_egg_fu
     if (!peep_has_valid_xy(peep))
         return;
 
-    uint16_t spriteIndex = sprite_get_first_in_quadrant(peep->x, peep->y);
-    if (spriteIndex == SPRITE_INDEX_NULL)
-        return;
-
-    rct_peep* otherPeep = GET_PEEP(spriteIndex);
-    for (; spriteIndex != SPRITE_INDEX_NULL; spriteIndex = otherPeep->next_in_quadrant)
+    // Copy the sprites as giving items can create balloons on the tile
+    std::vector<uint16_t> spriteIndices = sprite_get_tile_sprites(peep->x, peep->y);
+    for (uint16_t spriteIndex : spriteIndices)
     {
-        otherPeep = GET_PEEP(spriteIndex);
+        rct_peep* otherPeep = GET_PEEP(spriteIndex);
 
         if (otherPeep->sprite_identifier != SPRITE_IDENTIFIER_PEEP)
             continue;
@@ -3612,6 +3604,7 @@ void peep_update_name_sort(rct_peep* peep)
 finish_peep_sort:
     // This is required at the moment because this function reorders peeps in the sprite list
     sprite_position_tween_reset();
+    staff_invalidate_type_lists();
 }
 
 void peep_sort()
@@ -3648,6 +3641,7 @@ void peep_sort()
     gSpriteListHead[SPRITE_LIST_PEEP] = peep_list[0];
 
     free(peep_list);
+    staff_invalidate_type_lists();
 
     i = 0;
     FOR_ALL_PEEPS (sprite_index, peep)
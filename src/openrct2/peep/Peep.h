@@ -980,6 +980,8 @@ void game_command_set_guest_name(
     int32_t* eax, int32_t* ebx, int32_t* ecx, int32_t* edx, int32_t* esi, int32_t* edi, int32_t* ebp);
 
 int32_t peep_pathfind_choose_direction(TileCoordsXYZ loc, rct_peep* peep);
+void peep_pathfind_invalidate_cache();
+void peep_pathfind_invalidate_tile(int32_t x, int32_t y);
 void peep_reset_pathfind_goal(rct_peep* peep);
 
 bool is_valid_path_z_and_direction(rct_tile_element* tileElement, int32_t currentZ, int32_t currentDirection);
@@ -58,6 +58,10 @@ const rct_string_id StaffCostumeNames[] = {
 // Additionally there is a patrol area for each staff type, which is the union of the patrols of all staff members of that type
 uint32_t gStaffPatrolAreas[(STAFF_MAX_COUNT + STAFF_TYPE_COUNT) * STAFF_PATROL_AREA_SIZE];
 uint8_t gStaffModes[STAFF_MAX_COUNT + STAFF_TYPE_COUNT];
+
+// The sprite indices of the staff of each type in peep list order, so staff can be searched without walking the guests
+static std::vector<uint16_t> _staffTypeLists[STAFF_TYPE_COUNT];
+static bool _staffTypeListsValid;
 uint16_t gStaffDrawPatrolAreas;
 colour_t gStaffHandymanColour;
 colour_t gStaffMechanicColour;
@@ -76,6 +80,42 @@ void staff_reset_modes()
         gStaffModes[i] = STAFF_MODE_WALK;
 
     staff_update_greyed_patrol_areas();
+    staff_invalidate_type_lists();
+}
+
+/**
+ * Marks the per type staff lists as out of date. Needs to be called whenever staff are added or removed, or the
+ * order of the peep list changes.
+ */
+void staff_invalidate_type_lists()
+{
+    _staffTypeListsValid = false;
+}
+
+/**
+ * Gets the sprite indices of the staff of the given type, in the same order as FOR_ALL_STAFF visits them.
+ */
+const std::vector<uint16_t>& staff_get_type_list(uint8_t staffType)
+{
+    if (!_staffTypeListsValid)
+    {
+        for (auto& staffTypeList : _staffTypeLists)
+        {
+            staffTypeList.clear();
+        }
+
+        uint16_t spriteIndex;
+        rct_peep* peep;
+        FOR_ALL_STAFF (spriteIndex, peep)
+        {
+            if (peep->staff_type < STAFF_TYPE_COUNT)
+            {
+                _staffTypeLists[peep->staff_type].push_back(spriteIndex);
+            }
+        }
+        _staffTypeListsValid = true;
+    }
+    return _staffTypeLists[staffType];
 }
 
 static inline void staff_autoposition_new_staff_member(rct_peep* newPeep)
@@ -2290,11 +2330,9 @@ static int32_t peep_update_patrolling_find_sweeping(rct_peep* peep)
     if (!(peep->staff_orders & STAFF_ORDERS_SWEEPING))
         return 0;
 
-    uint16_t sprite_id = sprite_get_first_in_quadrant(peep->x, peep->y);
-
-    for (rct_sprite* sprite = nullptr; sprite_id != SPRITE_INDEX_NULL; sprite_id = sprite->unknown.next_in_quadrant)
+    for (uint16_t sprite_id : sprite_get_tile_sprites(peep->x, peep->y))
     {
-        sprite = get_sprite(sprite_id);
+        rct_sprite* sprite = get_sprite(sprite_id);
 
         if (sprite->unknown.linked_list_type_offset != SPRITE_LIST_LITTER * 2)
             continue;
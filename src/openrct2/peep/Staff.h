@@ -13,6 +13,8 @@
 #include "../common.h"
 #include "Peep.h"
 
+#include <vector>
+
 #define STAFF_MAX_COUNT 200
 // The number of elements in the gStaffPatrolAreas array per staff member. Every bit in the array represents a 4x4 square.
 // Right now, it's a 32-bit array like in RCT2. 32 * 128 = 4096 bits, which is also the number of 4x4 squares on a 256x256 map.
@@ -87,6 +89,8 @@ void game_command_pickup_staff(
     int32_t* eax, int32_t* ebx, int32_t* ecx, int32_t* edx, int32_t* esi, int32_t* edi, int32_t* ebp);
 
 void staff_reset_modes();
+void staff_invalidate_type_lists();
+const std::vector<uint16_t>& staff_get_type_list(uint8_t staffType);
 void staff_set_name(uint16_t spriteIndex, const char* name);
 uint16_t hire_new_staff_member(uint8_t staffType);
 void staff_update_greyed_patrol_areas();
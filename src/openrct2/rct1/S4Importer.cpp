@@ -2567,7 +2567,7 @@ private:
                     if (tileElement->GetType() == TILE_ELEMENT_TYPE_WALL)
                     {
                         rct_tile_element originalTileElement = *tileElement;
-                        tile_element_remove(tileElement);
+                        tile_element_remove(x, y, tileElement);
 
                         for (int32_t edge = 0; edge < 4; edge++)
                         {
@@ -0,0 +1,92 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "SawyerChecksumStream.h"
+
+#include "../util/SawyerCoding.h"
+
+SawyerChecksumStream::SawyerChecksumStream(IStream* stream)
+    : _stream(stream)
+    , _checksumEnd(stream->GetPosition())
+{
+}
+
+bool SawyerChecksumStream::CanRead() const
+{
+    return _stream->CanRead();
+}
+
+bool SawyerChecksumStream::CanWrite() const
+{
+    return _stream->CanWrite();
+}
+
+uint64_t SawyerChecksumStream::GetLength() const
+{
+    return _stream->GetLength();
+}
+
+uint64_t SawyerChecksumStream::GetPosition() const
+{
+    return _stream->GetPosition();
+}
+
+void SawyerChecksumStream::SetPosition(uint64_t position)
+{
+    _stream->SetPosition(position);
+}
+
+void SawyerChecksumStream::Seek(int64_t offset, int32_t origin)
+{
+    _stream->Seek(offset, origin);
+}
+
+void SawyerChecksumStream::Read(void* buffer, uint64_t length)
+{
+    uint64_t position = _stream->GetPosition();
+    _stream->Read(buffer, length);
+    AddToChecksum(position, buffer, length);
+}
+
+void SawyerChecksumStream::Write(const void* buffer, uint64_t length)
+{
+    uint64_t position = _stream->GetPosition();
+    if (position < _checksumEnd)
+    {
+        // The bytes being replaced have already been summed
+        _isComplete = false;
+    }
+    _stream->Write(buffer, length);
+    AddToChecksum(position, buffer, length);
+}
+
+uint64_t SawyerChecksumStream::TryRead(void* buffer, uint64_t length)
+{
+    uint64_t position = _stream->GetPosition();
+    uint64_t readBytes = _stream->TryRead(buffer, length);
+    AddToChecksum(position, buffer, readBytes);
+    return readBytes;
+}
+
+void SawyerChecksumStream::AddToChecksum(uint64_t position, const void* buffer, uint64_t length)
+{
+    if (position > _checksumEnd)
+    {
+        _isComplete = false;
+        return;
+    }
+
+    uint64_t end = position + length;
+    if (end > _checksumEnd)
+    {
+        uint64_t alreadySummed = _checksumEnd - position;
+        _checksum += sawyercoding_calculate_checksum((const uint8_t*)buffer + alreadySummed, (size_t)(end - _checksumEnd));
+        _checksumEnd = end;
+    }
+}
@@ -0,0 +1,62 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../common.h"
+#include "../core/IStream.hpp"
+
+/**
+ * Passes reads and writes through to another stream while summing the bytes that make up the checksum at the end of
+ * SV6 and SC6 files. Data read again after seeking back is only counted once. Skipping over data or overwriting data
+ * that has already been summed leaves the checksum incomplete.
+ */
+class SawyerChecksumStream final : public IStream
+{
+private:
+    IStream* const _stream = nullptr;
+    uint64_t _checksumEnd = 0;
+    uint32_t _checksum = 0;
+    bool _isComplete = true;
+
+public:
+    explicit SawyerChecksumStream(IStream* stream);
+
+    /**
+     * Gets the sum of every byte from where the stream was wrapped up to the furthest point read or written.
+     */
+    uint32_t GetChecksum() const
+    {
+        return _checksum;
+    }
+
+    bool IsChecksumComplete() const
+    {
+        return _isComplete;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // ISteam methods
+    ///////////////////////////////////////////////////////////////////////////
+    bool CanRead() const override;
+    bool CanWrite() const override;
+
+    uint64_t GetLength() const override;
+    uint64_t GetPosition() const override;
+    void SetPosition(uint64_t position) override;
+    void Seek(int64_t offset, int32_t origin) override;
+
+    void Read(void* buffer, uint64_t length) override;
+    void Write(const void* buffer, uint64_t length) override;
+
+    uint64_t TryRead(void* buffer, uint64_t length) override;
+
+private:
+    void AddToChecksum(uint64_t position, const void* buffer, uint64_t length);
+};
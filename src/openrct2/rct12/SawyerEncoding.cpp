@@ -10,6 +10,7 @@
 #include "SawyerEncoding.h"
 
 #include "../core/IStream.hpp"
+#include "SawyerChecksumStream.h"
 
 #include <algorithm>
 
@@ -57,4 +58,38 @@ namespace SawyerEncoding
             return false;
         }
     }
+
+    bool ValidateStreamedChecksum(SawyerChecksumStream* stream)
+    {
+        try
+        {
+            uint64_t length = stream->GetLength();
+            uint64_t position = stream->GetPosition();
+            if (length < 4 || position > length - 4)
+            {
+                return false;
+            }
+
+            uint64_t remaining = length - 4 - position;
+            while (remaining != 0)
+            {
+                uint8_t buffer[4096];
+                uint64_t bufferSize = std::min<uint64_t>(remaining, sizeof(buffer));
+                stream->Read(buffer, bufferSize);
+                remaining -= bufferSize;
+            }
+
+            if (!stream->IsChecksumComplete())
+            {
+                return false;
+            }
+            uint32_t checksum = stream->GetChecksum();
+            uint32_t fileChecksum = stream->ReadValue<uint32_t>();
+            return checksum == fileChecksum;
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+    }
 } // namespace SawyerEncoding
@@ -12,8 +12,15 @@
 #include "../common.h"
 
 interface IStream;
+class SawyerChecksumStream;
 
 namespace SawyerEncoding
 {
     bool ValidateChecksum(IStream* stream);
-}
+
+    /**
+     * Reads whatever is left before the checksum through the given stream, then compares everything the stream has
+     * summed with the checksum at the end. Used to validate a file as it is loaded rather than in a separate pass.
+     */
+    bool ValidateStreamedChecksum(SawyerChecksumStream* stream);
+} // namespace SawyerEncoding
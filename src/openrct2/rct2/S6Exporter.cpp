@@ -32,6 +32,7 @@
 #include "../object/ObjectManager.h"
 #include "../object/ObjectRepository.h"
 #include "../peep/Staff.h"
+#include "../rct12/SawyerChecksumStream.h"
 #include "../rct12/SawyerChunkWriter.h"
 #include "../ride/Ride.h"
 #include "../ride/RideRatings.h"
@@ -49,6 +50,8 @@
 #include <algorithm>
 #include <cstring>
 #include <functional>
+#include <memory>
+#include <thread>
 
 S6Exporter::S6Exporter()
 {
@@ -87,7 +90,9 @@ void S6Exporter::Save(IStream* stream, bool isScenario)
     _s6.header.magic_number = S6_MAGIC_NUMBER;
     _s6.game_version_number = 201028;
 
-    auto chunkWriter = SawyerChunkWriter(stream);
+    // Sum the bytes as they are written rather than reading the whole file back afterwards
+    SawyerChecksumStream checksumStream(stream);
+    auto chunkWriter = SawyerChunkWriter(&checksumStream);
 
     // 0: Write header chunk
     chunkWriter.WriteChunk(&_s6.header, SAWYER_ENCODING::ROTATE);
@@ -102,7 +107,7 @@ void S6Exporter::Save(IStream* stream, bool isScenario)
     if (_s6.header.num_packed_objects > 0)
     {
         auto objRepo = OpenRCT2::GetContext()->GetObjectRepository();
-        objRepo->WritePackedObjects(stream, ExportObjectsList);
+        objRepo->WritePackedObjects(&checksumStream, ExportObjectsList);
     }
 
     // 3: Write available objects chunk
@@ -132,22 +137,14 @@ void S6Exporter::Save(IStream* stream, bool isScenario)
         chunkWriter.WriteChunk(&_s6.next_free_tile_element_pointer_index, 0x2E8570, SAWYER_ENCODING::RLECOMPRESSED);
     }
 
-    // Determine number of bytes written
-    size_t fileSize = stream->GetLength();
-
-    // Read all written bytes back into a single buffer
-    stream->SetPosition(0);
-    auto data = std::unique_ptr<uint8_t, std::function<void(uint8_t*)>>(
-        stream->ReadArray<uint8_t>(fileSize), Memory::Free<uint8_t>);
-    uint32_t checksum = sawyercoding_calculate_checksum(data.get(), fileSize);
-
     // Write the checksum on the end
-    stream->SetPosition(fileSize);
-    stream->WriteValue(checksum);
+    openrct2_assert(checksumStream.IsChecksumComplete(), "Save was not written in order");
+    stream->WriteValue(checksumStream.GetChecksum());
 }
 
 void S6Exporter::Export()
 {
+    sprite_spatial_index_write_chains();
     int32_t spatial_cycle = check_for_spatial_index_cycles(false);
     int32_t regular_cycle = check_for_sprite_list_cycles(false);
     int32_t disjoint_sprites_count = fix_disjoint_sprites();
@@ -738,6 +735,19 @@ enum : uint32_t
     S6_SAVE_FLAG_AUTOMATIC = 1u << 31,
 };
 
+static std::thread _backgroundSaveThread;
+
+static void scenario_save_prepare(int32_t flags)
+{
+    if (!(flags & S6_SAVE_FLAG_AUTOMATIC))
+    {
+        window_close_construction_windows();
+    }
+
+    map_reorganise_elements();
+    viewport_set_saved_view();
+}
+
 /**
  *
  *  rct2: 0x006754F5
@@ -754,13 +764,7 @@ int32_t scenario_save(const utf8* path, int32_t flags)
         log_verbose("saving game");
     }
 
-    if (!(flags & S6_SAVE_FLAG_AUTOMATIC))
-    {
-        window_close_construction_windows();
-    }
-
-    map_reorganise_elements();
-    viewport_set_saved_view();
+    scenario_save_prepare(flags);
 
     bool result = false;
     auto s6exporter = new S6Exporter();
@@ -796,3 +800,65 @@ int32_t scenario_save(const utf8* path, int32_t flags)
     }
     return result;
 }
+
+/**
+ * Exports the park on the calling thread and leaves encoding, checksumming and writing the file to a background
+ * thread. The export is a complete copy of the park state, so the game can carry on straight away. The prepare
+ * function is run on the background thread before the file is written. Objects can not be packed into the save.
+ */
+void scenario_save_in_background(const utf8* path, int32_t flags, std::function<void()> prepareFn)
+{
+    openrct2_assert(!(flags & S6_SAVE_FLAG_EXPORT), "Objects can not be packed by a background save");
+
+    // Only one save is written at a time
+    scenario_wait_for_background_save();
+
+    log_verbose("saving game in the background");
+    scenario_save_prepare(flags);
+
+    auto s6exporter = std::make_shared<S6Exporter>();
+    try
+    {
+        s6exporter->RemoveTracklessRides = true;
+        s6exporter->Export();
+    }
+    catch (const std::exception& e)
+    {
+        log_error("Unable to save game: %s", e.what());
+        return;
+    }
+
+    gfx_invalidate_screen();
+
+    std::string savePath = path;
+    _backgroundSaveThread = std::thread([s6exporter, savePath, flags, prepareFn]() {
+        try
+        {
+            if (prepareFn)
+            {
+                prepareFn();
+            }
+            if (flags & S6_SAVE_FLAG_SCENARIO)
+            {
+                s6exporter->SaveScenario(savePath.c_str());
+            }
+            else
+            {
+                s6exporter->SaveGame(savePath.c_str());
+            }
+            log_verbose("saved to %s", savePath.c_str());
+        }
+        catch (const std::exception& e)
+        {
+            log_error("Unable to save game to %s: %s", savePath.c_str(), e.what());
+        }
+    });
+}
+
+void scenario_wait_for_background_save()
+{
+    if (_backgroundSaveThread.joinable())
+    {
+        _backgroundSaveThread.join();
+    }
+}
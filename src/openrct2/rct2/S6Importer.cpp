@@ -31,6 +31,7 @@
 #include "../object/ObjectManager.h"
 #include "../object/ObjectRepository.h"
 #include "../peep/Staff.h"
+#include "../rct12/SawyerChecksumStream.h"
 #include "../rct12/SawyerChunkReader.h"
 #include "../rct12/SawyerEncoding.h"
 #include "../ride/Ride.h"
@@ -107,12 +108,12 @@ public:
         IStream* stream, bool isScenario, [[maybe_unused]] bool skipObjectCheck = false,
         const utf8* path = String::Empty) override
     {
-        if (isScenario && !gConfigGeneral.allow_loading_with_incorrect_checksum && !SawyerEncoding::ValidateChecksum(stream))
-        {
-            throw IOException("Invalid checksum.");
-        }
+        // The checksum is summed as the chunks are read, rather than reading the whole file an extra time beforehand
+        bool validateChecksum = isScenario && !gConfigGeneral.allow_loading_with_incorrect_checksum;
+        uint64_t startPosition = stream->GetPosition();
+        SawyerChecksumStream checksumStream(stream);
 
-        auto chunkReader = SawyerChunkReader(stream);
+        auto chunkReader = SawyerChunkReader(&checksumStream);
         chunkReader.ReadChunk(&_s6.header, sizeof(_s6.header));
 
         log_verbose("saved game classic_flag = 0x%02x\n", _s6.header.classic_flag);
@@ -137,11 +138,24 @@ public:
             throw UnsupportedRCTCFlagException(_s6.header.classic_flag);
         }
 
+        if (validateChecksum && _s6.header.num_packed_objects > 0)
+        {
+            // Packed objects are added to the repository as they are read, so check the file before going any further
+            uint64_t position = stream->GetPosition();
+            stream->SetPosition(startPosition);
+            if (!SawyerEncoding::ValidateChecksum(stream))
+            {
+                throw IOException("Invalid checksum.");
+            }
+            stream->SetPosition(position);
+            validateChecksum = false;
+        }
+
         // Read packed objects
         // TODO try to contain this more and not store objects until later
         for (uint16_t i = 0; i < _s6.header.num_packed_objects; i++)
         {
-            _objectRepository->ExportPackedObject(stream);
+            _objectRepository->ExportPackedObject(&checksumStream);
         }
 
         if (isScenario)
@@ -166,6 +180,11 @@ public:
             chunkReader.ReadChunk(&_s6.next_free_tile_element_pointer_index, 3048816);
         }
 
+        if (validateChecksum && !SawyerEncoding::ValidateStreamedChecksum(&checksumStream))
+        {
+            throw IOException("Invalid checksum.");
+        }
+
         _s6Path = path;
 
         return ParkLoadResult(std::vector<rct_object_entry>(std::begin(_s6.objects), std::end(_s6.objects)));
@@ -461,6 +480,8 @@ public:
         {
             log_error("Found %d disjoint null sprites", disjoint_sprites_count);
         }
+        reset_sprite_list_index();
+        reset_sprite_spatial_index();
 
         if (String::Equals(_s6.scenario_filename, "Europe - European Cultural Festival.SC6"))
         {
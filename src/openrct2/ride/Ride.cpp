@@ -2852,15 +2852,12 @@ rct_peep* ride_find_closest_mechanic(Ride* ride, int32_t forInspection)
 rct_peep* find_closest_mechanic(int32_t x, int32_t y, int32_t forInspection)
 {
     uint32_t closestDistance, distance;
-    uint16_t spriteIndex;
-    rct_peep *peep, *closestMechanic = nullptr;
+    rct_peep* closestMechanic = nullptr;
 
     closestDistance = UINT_MAX;
-    FOR_ALL_STAFF (spriteIndex, peep)
+    for (uint16_t spriteIndex : staff_get_type_list(STAFF_TYPE_MECHANIC))
     {
-        if (peep->staff_type != STAFF_TYPE_MECHANIC)
-            continue;
-
+        rct_peep* peep = GET_PEEP(spriteIndex);
         if (!forInspection)
         {
             if (peep->state == PEEP_STATE_HEADING_TO_INSPECTION)
@@ -8184,7 +8181,7 @@ void sub_6CB945(int32_t rideIndex)
                 footpath_remove_edges_at(location.x, location.y, tileElement);
                 footpath_update_queue_chains();
                 map_invalidate_tile_full(location.x, location.y);
-                tile_element_remove(tileElement);
+                tile_element_remove(location.x / 32, location.y / 32, tileElement);
                 tileElement--;
             }
         } while (!(tileElement++)->IsLastForTile());
@@ -1445,7 +1445,8 @@ static money32 track_place(
             ride->overall_view.y = y / 32;
         }
 
-        tileElement = tile_element_insert(x / 32, y / 32, baseZ, bl & 0xF);
+        tileElement = tile_element_insert(
+            x / 32, y / 32, baseZ, (bl & 0xF) | ((flags & GAME_COMMAND_FLAG_GHOST) ? TILE_ELEMENT_FLAG_GHOST : 0));
         assert(tileElement != nullptr);
         tileElement->clearance_height = clearanceZ;
 
@@ -1795,7 +1796,7 @@ static money32 track_remove(
         {
             footpath_remove_edges_at(x, y, tileElement);
         }
-        tile_element_remove(tileElement);
+        tile_element_remove(x / 32, y / 32, tileElement);
         if (!(flags & GAME_COMMAND_FLAG_GHOST))
         {
             sub_6CB945(rideIndex);
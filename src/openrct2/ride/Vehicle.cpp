@@ -1327,22 +1327,15 @@ void vehicle_sounds_update()
  */
 void vehicle_update_all()
 {
-    uint16_t sprite_index;
-    rct_vehicle* vehicle;
-
     if (gScreenFlags & SCREEN_FLAGS_SCENARIO_EDITOR)
         return;
 
     if ((gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) && gS6Info.editor_step != EDITOR_STEP_ROLLERCOASTER_DESIGNER)
         return;
 
-    sprite_index = gSpriteListHead[SPRITE_LIST_TRAIN];
-    while (sprite_index != SPRITE_INDEX_NULL)
+    for (auto sprite : SpriteListRange(SPRITE_LIST_TRAIN))
     {
-        vehicle = GET_VEHICLE(sprite_index);
-        sprite_index = vehicle->next;
-
-        vehicle_update(vehicle);
+        vehicle_update(&sprite->vehicle);
     }
 }
 
@@ -6458,12 +6451,9 @@ bool vehicle_update_dodgems_collision(rct_vehicle* vehicle, int16_t x, int16_t y
         location.x += xy_offset.x;
         location.y += xy_offset.y;
 
-        uint16_t spriteIdx = sprite_get_first_in_quadrant(location.x * 32, location.y * 32);
-        while (spriteIdx != SPRITE_INDEX_NULL)
+        for (uint16_t spriteIdx : sprite_get_tile_sprites(location.x * 32, location.y * 32))
         {
             rct_vehicle* vehicle2 = GET_VEHICLE(spriteIdx);
-            spriteIdx = vehicle2->next_in_quadrant;
-
             if (vehicle2 == vehicle)
                 continue;
 
@@ -7690,9 +7680,9 @@ static bool vehicle_update_motion_collision_detection(
         location.x += xy_offset.x;
         location.y += xy_offset.y;
 
-        collideId = sprite_get_first_in_quadrant(location.x * 32, location.y * 32);
-        for (; collideId != SPRITE_INDEX_NULL; collideId = collideVehicle->next_in_quadrant)
+        for (uint16_t spriteIdx : sprite_get_tile_sprites(location.x * 32, location.y * 32))
         {
+            collideId = spriteIdx;
             collideVehicle = GET_VEHICLE(collideId);
             if (collideVehicle == vehicle)
                 continue;
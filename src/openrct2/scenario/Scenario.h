@@ -23,6 +23,8 @@
 #include "../world/MapAnimation.h"
 #include "../world/Sprite.h"
 
+#include <functional>
+
 struct ParkLoadResult;
 
 #pragma pack(push, 1)
@@ -406,6 +408,8 @@ uint32_t scenario_rand_max(uint32_t max);
 
 bool scenario_prepare_for_save();
 int32_t scenario_save(const utf8* path, int32_t flags);
+void scenario_save_in_background(const utf8* path, int32_t flags, std::function<void()> prepareFn);
+void scenario_wait_for_background_save();
 void scenario_remove_trackless_rides(rct_s6_data* s6);
 void scenario_fix_ghosts(rct_s6_data* s6);
 void scenario_failure();
@@ -107,7 +107,7 @@ static money32 BannerRemove(int16_t x, int16_t y, uint8_t baseHeight, uint8_t di
 
         tile_element_remove_banner_entry(tileElement);
         map_invalidate_tile_zoom1(x, y, z, z + 32);
-        tile_element_remove(tileElement);
+        tile_element_remove(x / 32, y / 32, tileElement);
     }
 
     if (gParkFlags & PARK_FLAGS_NO_MONEY)
@@ -42,7 +42,7 @@ static void ParkEntranceRemoveSegment(int32_t x, int32_t y, int32_t z)
     }
 
     map_invalidate_tile(x, y, tileElement->base_height * 8, tileElement->clearance_height * 8);
-    tile_element_remove(tileElement);
+    tile_element_remove(x / 32, y / 32, tileElement);
     update_park_fences({ x, y });
 }
 
@@ -262,7 +262,8 @@ static money32 RideEntranceExitPlace(
             coord.z = tile_element_height(coord.x, coord.y);
             network_set_player_last_action_coord(network_get_player_index(game_command_playerid), coord);
 
-            rct_tile_element* tileElement = tile_element_insert(x / 32, y / 32, z / 8, 0xF);
+            rct_tile_element* tileElement = tile_element_insert(
+                x / 32, y / 32, z / 8, 0xF | ((flags & GAME_COMMAND_FLAG_GHOST) ? TILE_ELEMENT_FLAG_GHOST : 0));
             assert(tileElement != nullptr);
             tileElement->SetType(TILE_ELEMENT_TYPE_ENTRANCE);
             tileElement->SetDirection(direction);
@@ -394,7 +395,7 @@ static money32 RideEntranceExitRemove(int16_t x, int16_t y, uint8_t rideIndex, u
 
         bool isExit = tileElement->properties.entrance.type == ENTRANCE_TYPE_RIDE_EXIT;
 
-        tile_element_remove(tileElement);
+        tile_element_remove(x / 32, y / 32, tileElement);
 
         if (isExit)
         {
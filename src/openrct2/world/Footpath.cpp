@@ -20,6 +20,7 @@
 #include "../object/ObjectList.h"
 #include "../object/ObjectManager.h"
 #include "../paint/VirtualFloor.h"
+#include "../peep/Peep.h"
 #include "../ride/Station.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
@@ -262,7 +263,8 @@ static money32 footpath_element_insert(
         }
         else
         {
-            tileElement = tile_element_insert(x / 32, y / 32, z, 0x0F);
+            tileElement = tile_element_insert(
+                x / 32, y / 32, z, 0x0F | ((flags & GAME_COMMAND_FLAG_GHOST) ? TILE_ELEMENT_FLAG_GHOST : 0));
             assert(tileElement != nullptr);
             tileElement->type = TILE_ELEMENT_TYPE_PATH;
             tileElement->clearance_height = z + 4 + ((slope & TILE_ELEMENT_SLOPE_NE_SIDE_UP) ? 2 : 0);
@@ -378,6 +380,7 @@ static money32 footpath_element_update(
 
         footpath_element_set_path_scenery(tileElement, pathItemType);
         tileElement->flags &= ~TILE_ELEMENT_FLAG_BROKEN;
+        map_invalidate_tile_indices_at(x / 32, y / 32);
         if (pathItemType != 0)
         {
             rct_scenery_entry* scenery_entry = get_footpath_item_entry(pathItemType - 1);
@@ -405,6 +408,7 @@ static money32 footpath_element_update(
         tileElement->type = (tileElement->type & 0xFE) | (type >> 7);
         footpath_element_set_path_scenery(tileElement, pathItemType);
         tileElement->flags &= ~TILE_ELEMENT_FLAG_BROKEN;
+        map_invalidate_tile_indices_at(x / 32, y / 32);
 
         loc_6A6620(flags, x, y, tileElement);
     }
@@ -642,7 +646,8 @@ static money32 footpath_place_from_track(
         }
         else
         {
-            tileElement = tile_element_insert(x / 32, y / 32, z, 0x0F);
+            tileElement = tile_element_insert(
+                x / 32, y / 32, z, 0x0F | ((flags & GAME_COMMAND_FLAG_GHOST) ? TILE_ELEMENT_FLAG_GHOST : 0));
             assert(tileElement != nullptr);
             tileElement->type = TILE_ELEMENT_TYPE_PATH;
             tileElement->clearance_height = z + 4 + ((slope & TILE_ELEMENT_SLOPE_S_CORNER_UP) ? 2 : 0);
@@ -966,11 +971,11 @@ void footpath_bridge_get_info_from_pos(
  */
 void footpath_remove_litter(int32_t x, int32_t y, int32_t z)
 {
-    uint16_t spriteIndex = sprite_get_first_in_quadrant(x, y);
-    while (spriteIndex != SPRITE_INDEX_NULL)
+    // Copy the sprites as removing litter modifies the tile
+    std::vector<uint16_t> spriteIndices = sprite_get_tile_sprites(x, y);
+    for (uint16_t spriteIndex : spriteIndices)
     {
         rct_litter* sprite = &get_sprite(spriteIndex)->litter;
-        uint16_t nextSpriteIndex = sprite->next_in_quadrant;
         if (sprite->linked_list_type_offset == SPRITE_LIST_LITTER * 2)
         {
             int32_t distanceZ = abs(sprite->z - z);
@@ -980,7 +985,6 @@ void footpath_remove_litter(int32_t x, int32_t y, int32_t z)
                 sprite_remove((rct_sprite*)sprite);
             }
         }
-        spriteIndex = nextSpriteIndex;
     }
 }
 
@@ -990,11 +994,9 @@ void footpath_remove_litter(int32_t x, int32_t y, int32_t z)
  */
 void footpath_interrupt_peeps(int32_t x, int32_t y, int32_t z)
 {
-    uint16_t spriteIndex = sprite_get_first_in_quadrant(x, y);
-    while (spriteIndex != SPRITE_INDEX_NULL)
+    for (uint16_t spriteIndex : sprite_get_tile_sprites(x, y))
     {
         rct_peep* peep = &get_sprite(spriteIndex)->peep;
-        uint16_t nextSpriteIndex = peep->next_in_quadrant;
         if (peep->linked_list_type_offset == SPRITE_LIST_PEEP * 2)
         {
             if (peep->state == PEEP_STATE_SITTING || peep->state == PEEP_STATE_WATCHING)
@@ -1009,7 +1011,6 @@ void footpath_interrupt_peeps(int32_t x, int32_t y, int32_t z)
                 }
             }
         }
-        spriteIndex = nextSpriteIndex;
     }
 }
 
@@ -1456,6 +1457,11 @@ static void loc_6A6D7E(
             {
                 footpath_queue_chain_push(tileElement->properties.path.ride_index);
             }
+            if (!(tileElement->flags & TILE_ELEMENT_FLAG_GHOST))
+            {
+                // Ghosts don't drop the pathfinding cache when placed, but may still connect to real paths
+                map_invalidate_tile_indices_at(x >> 5, y >> 5);
+            }
         }
         if (!(flags & (GAME_COMMAND_FLAG_GHOST | GAME_COMMAND_FLAG_ALLOW_DURING_PAUSED)))
         {
@@ -1675,6 +1681,11 @@ void footpath_chain_ride_queue(
             tileElement->properties.path.additions |= (entranceIndex << 4) & FOOTPATH_PROPERTIES_ADDITIONS_STATION_INDEX_MASK;
 
             map_invalidate_element(x, y, tileElement);
+            if (!(tileElement->flags & TILE_ELEMENT_FLAG_GHOST))
+            {
+                // The queue may be chained to a ghost entrance, which doesn't drop the pathfinding cache itself
+                map_invalidate_tile_indices_at(x >> 5, y >> 5);
+            }
 
             if (lastQueuePathElement == nullptr)
             {
@@ -2080,6 +2091,25 @@ static void footpath_clear_wide(int32_t x, int32_t y)
     } while (!(tileElement++)->IsLastForTile());
 }
 
+/**
+ * Gets the wide flags of the paths on a tile as a bit mask, in element order.
+ */
+static uint32_t footpath_get_wide_flags(int32_t x, int32_t y)
+{
+    uint32_t wideFlags = 0;
+    uint32_t bit = 1;
+    rct_tile_element* tileElement = map_get_first_element_at(x / 32, y / 32);
+    do
+    {
+        if (tileElement->GetType() != TILE_ELEMENT_TYPE_PATH)
+            continue;
+        if (footpath_element_is_wide(tileElement))
+            wideFlags |= bit;
+        bit <<= 1;
+    } while (!(tileElement++)->IsLastForTile());
+    return wideFlags;
+}
+
 /**
  *
  *  rct2: 0x006A8ACF
@@ -2120,6 +2150,7 @@ void footpath_update_path_wide_flags(int32_t x, int32_t y)
     if (y > 0x1FDF)
         return;
 
+    uint32_t oldWideFlags = footpath_get_wide_flags(x, y);
     footpath_clear_wide(x, y);
     /* Rather than clearing the wide flag of the following tiles and
      * checking the state of them later, leave them intact and assume
@@ -2304,6 +2335,12 @@ void footpath_update_path_wide_flags(int32_t x, int32_t y)
                 footpath_element_set_wide(tileElement, true);
         }
     } while (!(tileElement++)->IsLastForTile());
+
+    // Wide paths end pathfinding searches
+    if (footpath_get_wide_flags(x, y) != oldWideFlags)
+    {
+        peep_pathfind_invalidate_cache();
+    }
 }
 
 bool footpath_is_blocked_by_vehicle(const TileCoordsXYZ& position)
@@ -2366,6 +2403,11 @@ static void footpath_remove_edges_towards_here(
     d = (((d - 4) + 1) & 3) + 4;
     tileElement->properties.path.edges &= ~(1 << d);
     map_invalidate_tile(x, y, tileElement->base_height * 8, tileElement->clearance_height * 8);
+    if (!(tileElement->flags & TILE_ELEMENT_FLAG_GHOST))
+    {
+        // Ghosts don't drop the pathfinding cache when removed, but may still have been connected to real paths
+        map_invalidate_tile_indices_at(x >> 5, y >> 5);
+    }
 
     if (isQueue)
         footpath_disconnect_queue_from_path(x, y, tileElement, -1);
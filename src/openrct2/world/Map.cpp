@@ -26,6 +26,7 @@
 #include "../localisation/Localisation.h"
 #include "../management/Finance.h"
 #include "../network/network.h"
+#include "../peep/Peep.h"
 #include "../ride/RideData.h"
 #include "../ride/Track.h"
 #include "../ride/TrackData.h"
@@ -46,6 +47,8 @@
 #include "Wall.h"
 
 #include <algorithm>
+#include <iterator>
+#include <vector>
 
 /**
  * Replaces 0x00993CCC, 0x00993CCE
@@ -114,6 +117,27 @@ LocationXYZ16 gCommandPosition;
 
 bool gMapLandRightsUpdateSuccess;
 
+// Tracks which rides have track on which tiles, one 8x8 tile mask per ride for each block of 8x8 tiles
+constexpr int32_t RIDE_PRESENCE_BLOCK_SIZE = 8;
+constexpr int32_t RIDE_PRESENCE_BLOCKS_PER_ROW = MAXIMUM_MAP_SIZE_TECHNICAL / RIDE_PRESENCE_BLOCK_SIZE;
+
+struct RidePresenceEntry
+{
+    uint8_t RideIndex;
+    uint64_t Tiles;
+};
+
+static std::vector<RidePresenceEntry> _ridePresenceBlocks[RIDE_PRESENCE_BLOCKS_PER_ROW * RIDE_PRESENCE_BLOCKS_PER_ROW];
+static bool _ridePresenceDirtyBlocks[RIDE_PRESENCE_BLOCKS_PER_ROW * RIDE_PRESENCE_BLOCKS_PER_ROW];
+static bool _ridePresenceDirtyRides[RIDE_ID_NULL + 1];
+static bool _ridePresenceDirty = true;
+
+// Per tile counts of the things guests take note of when assessing their surroundings
+static MapSurroundings _tileSurroundings[MAX_TILE_TILE_ELEMENT_POINTERS];
+static bool _tileSurroundingsDirty[MAX_TILE_TILE_ELEMENT_POINTERS];
+static std::vector<int32_t> _tileSurroundingsDirtyList;
+static bool _tileSurroundingsDirtyAll = true;
+
 static void map_update_grass_length(int32_t x, int32_t y, rct_tile_element* tileElement);
 static void map_set_grass_length(int32_t x, int32_t y, rct_tile_element* tileElement, int32_t length);
 static void clear_elements_at(int32_t x, int32_t y);
@@ -260,6 +284,7 @@ void map_set_tile_elements(int32_t x, int32_t y, rct_tile_element* elements)
         return;
     }
     gTileElementTilePointers[x + y * MAXIMUM_MAP_SIZE_TECHNICAL] = elements;
+    map_invalidate_tile_indices_at(x, y);
 }
 
 rct_tile_element* map_get_surface_element_at(int32_t x, int32_t y)
@@ -456,6 +481,272 @@ void map_update_tile_pointers()
     }
 
     gNextFreeTileElement = tileElement;
+    map_invalidate_tile_indices();
+}
+
+/**
+ * Marks everything derived from the tile elements (ride presence, surroundings and park size) as out of date, required
+ * whenever the tile elements are replaced wholesale.
+ */
+void map_invalidate_tile_indices()
+{
+    std::fill(std::begin(_ridePresenceDirtyBlocks), std::end(_ridePresenceDirtyBlocks), true);
+    _ridePresenceDirty = true;
+    _tileSurroundingsDirtyAll = true;
+    peep_pathfind_invalidate_cache();
+    park_invalidate_size();
+}
+
+static void map_invalidate_tile_surroundings_at(int32_t x, int32_t y)
+{
+    if (x < 0 || y < 0 || x >= MAXIMUM_MAP_SIZE_TECHNICAL || y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+        return;
+
+    // The counts are kept per tile, so the counts of the neighbouring tiles are not affected
+    int32_t tileIndex = y * MAXIMUM_MAP_SIZE_TECHNICAL + x;
+    if (!_tileSurroundingsDirty[tileIndex])
+    {
+        _tileSurroundingsDirty[tileIndex] = true;
+        _tileSurroundingsDirtyList.push_back(tileIndex);
+    }
+}
+
+static void map_invalidate_tile_elements_at(int32_t x, int32_t y, bool ghost)
+{
+    if (x < 0 || y < 0 || x >= MAXIMUM_MAP_SIZE_TECHNICAL || y >= MAXIMUM_MAP_SIZE_TECHNICAL)
+        return;
+
+    int32_t blockIndex = (y / RIDE_PRESENCE_BLOCK_SIZE) * RIDE_PRESENCE_BLOCKS_PER_ROW + (x / RIDE_PRESENCE_BLOCK_SIZE);
+    _ridePresenceDirtyBlocks[blockIndex] = true;
+    _ridePresenceDirty = true;
+
+    map_invalidate_tile_surroundings_at(x, y);
+
+    if (ghost)
+    {
+        // The search ignores ghosts, so only the nodes pointing at the moved elements of the tile are out of date
+        peep_pathfind_invalidate_tile(x, y);
+    }
+    else
+    {
+        // The cached searches and pathfinding nodes were built from the paths, edges and entrances of the tile, which
+        // may have changed
+        peep_pathfind_invalidate_cache();
+    }
+}
+
+/**
+ * Marks the data derived from the elements of a single tile as out of date. Needs to be called when elements are
+ * modified in place, adding and removing elements takes care of it.
+ */
+void map_invalidate_tile_indices_at(int32_t x, int32_t y)
+{
+    map_invalidate_tile_elements_at(x, y, false);
+}
+
+static void map_rebuild_ride_presence_block(int32_t blockIndex)
+{
+    auto& entries = _ridePresenceBlocks[blockIndex];
+    entries.clear();
+
+    int32_t blockX = (blockIndex % RIDE_PRESENCE_BLOCKS_PER_ROW) * RIDE_PRESENCE_BLOCK_SIZE;
+    int32_t blockY = (blockIndex / RIDE_PRESENCE_BLOCKS_PER_ROW) * RIDE_PRESENCE_BLOCK_SIZE;
+    for (int32_t y = 0; y < RIDE_PRESENCE_BLOCK_SIZE; y++)
+    {
+        for (int32_t x = 0; x < RIDE_PRESENCE_BLOCK_SIZE; x++)
+        {
+            rct_tile_element* tileElement = map_get_first_element_at(blockX + x, blockY + y);
+            do
+            {
+                if (tileElement->GetType() != TILE_ELEMENT_TYPE_TRACK)
+                    continue;
+
+                uint8_t rideIndex = track_element_get_ride_index(tileElement);
+                auto it = std::find_if(entries.begin(), entries.end(), [rideIndex](const RidePresenceEntry& entry) {
+                    return entry.RideIndex == rideIndex;
+                });
+                if (it == entries.end())
+                {
+                    it = entries.insert(it, { rideIndex, 0 });
+                }
+                it->Tiles |= 1ULL << (y * RIDE_PRESENCE_BLOCK_SIZE + x);
+            } while (!(tileElement++)->IsLastForTile());
+        }
+    }
+}
+
+static void map_update_ride_presence()
+{
+    // Removed track only records its ride, so rescan every block that ride was in
+    for (int32_t i = 0; i < RIDE_PRESENCE_BLOCKS_PER_ROW * RIDE_PRESENCE_BLOCKS_PER_ROW; i++)
+    {
+        for (const auto& entry : _ridePresenceBlocks[i])
+        {
+            if (_ridePresenceDirtyRides[entry.RideIndex])
+            {
+                _ridePresenceDirtyBlocks[i] = true;
+                break;
+            }
+        }
+    }
+    std::fill(std::begin(_ridePresenceDirtyRides), std::end(_ridePresenceDirtyRides), false);
+
+    for (int32_t i = 0; i < RIDE_PRESENCE_BLOCKS_PER_ROW * RIDE_PRESENCE_BLOCKS_PER_ROW; i++)
+    {
+        if (_ridePresenceDirtyBlocks[i])
+        {
+            map_rebuild_ride_presence_block(i);
+            _ridePresenceDirtyBlocks[i] = false;
+        }
+    }
+    _ridePresenceDirty = false;
+}
+
+static MapSurroundings map_count_tile_surroundings(int32_t x, int32_t y)
+{
+    MapSurroundings result = {};
+    rct_tile_element* tileElement = map_get_first_element_at(x, y);
+    do
+    {
+        rct_scenery_entry* scenery;
+        switch (tileElement->GetType())
+        {
+            case TILE_ELEMENT_TYPE_PATH:
+                if (!footpath_element_has_path_scenery(tileElement))
+                    break;
+
+                scenery = get_footpath_item_entry(footpath_element_get_path_scenery_index(tileElement));
+                if (scenery == nullptr)
+                {
+                    result.HasInvalidPathItem = true;
+                    break;
+                }
+                if (footpath_element_path_scenery_is_ghost(tileElement))
+                    break;
+
+                if (scenery->path_bit.flags & (PATH_BIT_FLAG_JUMPING_FOUNTAIN_WATER | PATH_BIT_FLAG_JUMPING_FOUNTAIN_SNOW))
+                {
+                    result.NumFountains++;
+                    break;
+                }
+                if (tileElement->flags & TILE_ELEMENT_FLAG_BROKEN)
+                {
+                    result.NumBrokenPathItems++;
+                }
+                break;
+            case TILE_ELEMENT_TYPE_LARGE_SCENERY:
+            case TILE_ELEMENT_TYPE_SMALL_SCENERY:
+                result.NumScenery++;
+                break;
+        }
+    } while (!(tileElement++)->IsLastForTile());
+    return result;
+}
+
+static void map_update_tile_surroundings()
+{
+    if (_tileSurroundingsDirtyAll)
+    {
+        for (int32_t y = 0; y < MAXIMUM_MAP_SIZE_TECHNICAL; y++)
+        {
+            for (int32_t x = 0; x < MAXIMUM_MAP_SIZE_TECHNICAL; x++)
+            {
+                _tileSurroundings[y * MAXIMUM_MAP_SIZE_TECHNICAL + x] = map_count_tile_surroundings(x, y);
+            }
+        }
+        _tileSurroundingsDirtyAll = false;
+    }
+    else
+    {
+        for (int32_t tileIndex : _tileSurroundingsDirtyList)
+        {
+            _tileSurroundings[tileIndex] = map_count_tile_surroundings(
+                tileIndex % MAXIMUM_MAP_SIZE_TECHNICAL, tileIndex / MAXIMUM_MAP_SIZE_TECHNICAL);
+        }
+    }
+
+    for (int32_t tileIndex : _tileSurroundingsDirtyList)
+    {
+        _tileSurroundingsDirty[tileIndex] = false;
+    }
+    _tileSurroundingsDirtyList.clear();
+}
+
+/**
+ * Gets the scenery, fountains and broken path items within the given inclusive range of tiles. The counts wrap the
+ * same way as counting each element into a uint16_t would.
+ */
+MapSurroundings map_get_surroundings(int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    if (_tileSurroundingsDirtyAll || !_tileSurroundingsDirtyList.empty())
+    {
+        map_update_tile_surroundings();
+    }
+
+    left = std::max(0, left);
+    top = std::max(0, top);
+    right = std::min(MAXIMUM_MAP_SIZE_TECHNICAL - 1, right);
+    bottom = std::min(MAXIMUM_MAP_SIZE_TECHNICAL - 1, bottom);
+
+    MapSurroundings result = {};
+    for (int32_t y = top; y <= bottom; y++)
+    {
+        for (int32_t x = left; x <= right; x++)
+        {
+            const auto& tile = _tileSurroundings[y * MAXIMUM_MAP_SIZE_TECHNICAL + x];
+            result.NumScenery += tile.NumScenery;
+            result.NumFountains += tile.NumFountains;
+            result.NumBrokenPathItems += tile.NumBrokenPathItems;
+            result.HasInvalidPathItem |= tile.HasInvalidPathItem;
+        }
+    }
+    return result;
+}
+
+/**
+ * Sets the bit of every ride that has track within the given inclusive range of tiles, the same set of rides that
+ * scanning each tile of the range for track elements would give.
+ */
+void map_get_rides_in_range(int32_t left, int32_t top, int32_t right, int32_t bottom, uint32_t rideBits[8])
+{
+    if (_ridePresenceDirty)
+    {
+        map_update_ride_presence();
+    }
+
+    left = std::max(0, left);
+    top = std::max(0, top);
+    right = std::min(MAXIMUM_MAP_SIZE_TECHNICAL - 1, right);
+    bottom = std::min(MAXIMUM_MAP_SIZE_TECHNICAL - 1, bottom);
+    if (left > right || top > bottom)
+        return;
+
+    for (int32_t blockY = top / RIDE_PRESENCE_BLOCK_SIZE; blockY <= bottom / RIDE_PRESENCE_BLOCK_SIZE; blockY++)
+    {
+        int32_t y0 = std::max(top - blockY * RIDE_PRESENCE_BLOCK_SIZE, 0);
+        int32_t y1 = std::min(bottom - blockY * RIDE_PRESENCE_BLOCK_SIZE, RIDE_PRESENCE_BLOCK_SIZE - 1);
+        for (int32_t blockX = left / RIDE_PRESENCE_BLOCK_SIZE; blockX <= right / RIDE_PRESENCE_BLOCK_SIZE; blockX++)
+        {
+            int32_t x0 = std::max(left - blockX * RIDE_PRESENCE_BLOCK_SIZE, 0);
+            int32_t x1 = std::min(right - blockX * RIDE_PRESENCE_BLOCK_SIZE, RIDE_PRESENCE_BLOCK_SIZE - 1);
+
+            // Mask of the tiles in this block that are within the square
+            uint64_t rowMask = ((1ULL << (x1 - x0 + 1)) - 1) << x0;
+            uint64_t mask = 0;
+            for (int32_t y = y0; y <= y1; y++)
+            {
+                mask |= rowMask << (y * RIDE_PRESENCE_BLOCK_SIZE);
+            }
+
+            for (const auto& entry : _ridePresenceBlocks[blockY * RIDE_PRESENCE_BLOCKS_PER_ROW + blockX])
+            {
+                if (entry.Tiles & mask)
+                {
+                    rideBits[entry.RideIndex >> 5] |= (1u << (entry.RideIndex & 0x1F));
+                }
+            }
+        }
+    }
 }
 
 /**
@@ -939,7 +1230,7 @@ void game_command_remove_large_scenery(
                 continue;
 
             map_invalidate_tile_full(currentTile.x, currentTile.y);
-            tile_element_remove(sceneryElement);
+            tile_element_remove(currentTile.x / 32, currentTile.y / 32, sceneryElement);
             element_found = true;
             break;
         } while (!(sceneryElement++)->IsLastForTile());
@@ -1609,7 +1900,7 @@ static money32 map_set_land_height(int32_t flags, int32_t x, int32_t y, int32_t
             }
             cost += MONEY(sceneryEntry->small_scenery.removal_price, 0);
             if (flags & GAME_COMMAND_FLAG_APPLY)
-                tile_element_remove(tileElement--);
+                tile_element_remove(x / 32, y / 32, tileElement--);
         } while (!(tileElement++)->IsLastForTile());
     }
 
@@ -3072,7 +3363,9 @@ void game_command_place_large_scenery(
                 network_set_player_last_action_coord(network_get_player_index(game_command_playerid), coord);
             }
 
-            rct_tile_element* new_tile_element = tile_element_insert(curTile.x / 32, curTile.y / 32, zLow, F43887);
+            rct_tile_element* new_tile_element = tile_element_insert(
+                curTile.x / 32, curTile.y / 32, zLow,
+                F43887 | ((flags & GAME_COMMAND_FLAG_GHOST) ? TILE_ELEMENT_FLAG_GHOST : 0));
             assert(new_tile_element != nullptr);
             map_animation_create(MAP_ANIMATION_TYPE_LARGE_SCENERY, curTile.x, curTile.y, zLow);
 
@@ -3119,11 +3412,41 @@ int32_t tile_element_get_station(const rct_tile_element* tileElement)
 }
 
 /**
+ * Removes an element from the tile at the given tile coordinates.
  *
  *  rct2: 0x0068B280
  */
-void tile_element_remove(rct_tile_element* tileElement)
+void tile_element_remove(int32_t x, int32_t y, rct_tile_element* tileElement)
 {
+    if ((tileElement->flags & TILE_ELEMENT_FLAG_GHOST) && tileElement->GetType() != TILE_ELEMENT_TYPE_BANNER)
+    {
+        // The search ignores ghosts other than banners, but the nodes of the tile point at the elements that are moved
+        // down below
+        peep_pathfind_invalidate_tile(x, y);
+    }
+    else
+    {
+        // The cached searches and pathfinding nodes were built from the paths and edges of the tile, which are
+        // changing, and the nodes point at the elements that are moved down below
+        peep_pathfind_invalidate_cache();
+    }
+
+    switch (tileElement->GetType())
+    {
+        case TILE_ELEMENT_TYPE_TRACK:
+            _ridePresenceDirtyRides[track_element_get_ride_index(tileElement)] = true;
+            _ridePresenceDirty = true;
+            break;
+        case TILE_ELEMENT_TYPE_PATH:
+        case TILE_ELEMENT_TYPE_SMALL_SCENERY:
+        case TILE_ELEMENT_TYPE_LARGE_SCENERY:
+            map_invalidate_tile_surroundings_at(x, y);
+            break;
+        case TILE_ELEMENT_TYPE_SURFACE:
+            park_invalidate_size();
+            break;
+    }
+
     // Replace Nth element by (N+1)th element.
     // This loop will make tileElement point to the old last element position,
     // after copy it to it's new position
@@ -3173,7 +3496,7 @@ void map_remove_all_rides()
             case TILE_ELEMENT_TYPE_TRACK:
                 footpath_queue_chain_reset();
                 footpath_remove_edges_at(it.x * 32, it.y * 32, it.element);
-                tile_element_remove(it.element);
+                tile_element_remove(it.x, it.y, it.element);
                 tile_element_iterator_restart_for_tile(&it);
                 break;
         }
@@ -3352,6 +3675,8 @@ bool map_check_free_elements_and_reorganise(int32_t numElements)
 }
 
 /**
+ * Inserts an element with the given occupied quadrants in flags. Ghost elements that the pathfinding search ignores,
+ * i.e. anything but banners, can pass TILE_ELEMENT_FLAG_GHOST as well so that previews don't drop its cache.
  *
  *  rct2: 0x0068B1F6
  */
@@ -3368,6 +3693,9 @@ rct_tile_element* tile_element_insert(int32_t x, int32_t y, int32_t z, int32_t f
     newTileElement = gNextFreeTileElement;
     originalTileElement = gTileElementTilePointers[y * MAXIMUM_MAP_SIZE_TECHNICAL + x];
 
+    // The type of the new element is not set yet, so the tile is rescanned once the index is next used
+    map_invalidate_tile_elements_at(x, y, (flags & TILE_ELEMENT_FLAG_GHOST) != 0);
+
     // Set tile index pointer to point to new element block
     gTileElementTilePointers[y * MAXIMUM_MAP_SIZE_TECHNICAL + x] = newTileElement;
 
@@ -3875,7 +4203,7 @@ void map_extend_boundary_surface()
             & TILE_ELEMENT_SURFACE_EDGE_STYLE_MASK;
         newTileElement->properties.surface.terrain = existingTileElement->properties.surface.terrain;
         newTileElement->properties.surface.grass_length = existingTileElement->properties.surface.grass_length;
-        newTileElement->properties.surface.ownership = 0;
+        park_set_surface_ownership(newTileElement, 0);
 
         z = existingTileElement->base_height;
         slope = existingTileElement->properties.surface.slope & TILE_ELEMENT_SLOPE_NW_SIDE_UP;
@@ -3919,7 +4247,7 @@ void map_extend_boundary_surface()
             & TILE_ELEMENT_SURFACE_EDGE_STYLE_MASK;
         newTileElement->properties.surface.terrain = existingTileElement->properties.surface.terrain;
         newTileElement->properties.surface.grass_length = existingTileElement->properties.surface.grass_length;
-        newTileElement->properties.surface.ownership = 0;
+        park_set_surface_ownership(newTileElement, 0);
 
         z = existingTileElement->base_height;
         slope = existingTileElement->properties.surface.slope & TILE_ELEMENT_SLOPE_NE_SIDE_UP;
@@ -3968,7 +4296,7 @@ static void clear_element_at(int32_t x, int32_t y, rct_tile_element** elementPtr
             element->properties.surface.slope = TILE_ELEMENT_SLOPE_FLAT;
             element->properties.surface.terrain = 0;
             element->properties.surface.grass_length = GRASS_LENGTH_CLEAR_0;
-            element->properties.surface.ownership = 0;
+            park_set_surface_ownership(element, 0);
             // Because this element is not completely removed, the pointer must be updated manually
             // The rest of the elements are removed from the array, so the pointer doesn't need to be updated.
             (*elementPtr)++;
@@ -4011,7 +4339,7 @@ static void clear_element_at(int32_t x, int32_t y, rct_tile_element** elementPtr
                 GAME_COMMAND_REMOVE_BANNER, 0, 0);
             break;
         default:
-            tile_element_remove(element);
+            tile_element_remove(x / 32, y / 32, element);
             break;
     }
 }
@@ -4974,7 +5302,7 @@ void FixLandOwnershipTilesWithOwnership(std::initializer_list<TileCoordsXY> tile
     for (const TileCoordsXY* tile = tiles.begin(); tile != tiles.end(); ++tile)
     {
         currentElement = map_get_surface_element_at((*tile).x, (*tile).y);
-        currentElement->properties.surface.ownership |= ownership;
+        park_set_surface_ownership(currentElement, currentElement->properties.surface.ownership | ownership);
         update_park_fences_around_tile({ (*tile).x * 32, (*tile).y * 32 });
     }
 }
@@ -43,6 +43,15 @@ struct CoordsXYE
     rct_tile_element* element;
 };
 
+// What guests see around them, counted over a range of tiles
+struct MapSurroundings
+{
+    uint16_t NumScenery;
+    uint16_t NumFountains;
+    uint16_t NumBrokenPathItems;
+    bool HasInvalidPathItem;
+};
+
 enum
 {
     MAP_SELECT_FLAG_ENABLE = 1 << 0,
@@ -131,6 +140,10 @@ void map_init(int32_t size);
 void map_count_remaining_land_rights();
 void map_strip_ghost_flag_from_elements();
 void map_update_tile_pointers();
+void map_invalidate_tile_indices();
+void map_invalidate_tile_indices_at(int32_t x, int32_t y);
+void map_get_rides_in_range(int32_t left, int32_t top, int32_t right, int32_t bottom, uint32_t rideBits[8]);
+MapSurroundings map_get_surroundings(int32_t left, int32_t top, int32_t right, int32_t bottom);
 rct_tile_element* map_get_first_element_at(int32_t x, int32_t y);
 rct_tile_element* map_get_nth_element_at(int32_t x, int32_t y, int32_t n);
 void map_set_tile_elements(int32_t x, int32_t y, rct_tile_element* elements);
@@ -156,7 +169,7 @@ bool map_is_location_owned(int32_t x, int32_t y, int32_t z);
 bool map_is_location_in_park(CoordsXY coords);
 bool map_is_location_owned_or_has_rights(int32_t x, int32_t y);
 bool map_surface_is_blocked(int16_t x, int16_t y);
-void tile_element_remove(rct_tile_element* tileElement);
+void tile_element_remove(int32_t x, int32_t y, rct_tile_element* tileElement);
 void map_remove_all_rides();
 void map_invalidate_map_selection_tiles();
 void map_get_bounding_box(
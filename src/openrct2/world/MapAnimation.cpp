@@ -199,8 +199,7 @@ static bool map_animation_invalidate_small_scenery(int32_t x, int32_t y, int32_t
                 int32_t x2 = x - CoordsDirectionDelta[direction].x;
                 int32_t y2 = y - CoordsDirectionDelta[direction].y;
 
-                uint16_t spriteIdx = sprite_get_first_in_quadrant(x2, y2);
-                for (; spriteIdx != SPRITE_INDEX_NULL; spriteIdx = sprite->unknown.next_in_quadrant)
+                for (uint16_t spriteIdx : sprite_get_tile_sprites(x2, y2))
                 {
                     sprite = get_sprite(spriteIdx);
                     if (sprite->unknown.linked_list_type_offset != SPRITE_LIST_PEEP * 2)
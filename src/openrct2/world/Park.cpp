@@ -16,6 +16,7 @@
 #include "../GameState.h"
 #include "../OpenRCT2.h"
 #include "../config/Config.h"
+#include "../core/Guard.hpp"
 #include "../core/Memory.hpp"
 #include "../core/Util.hpp"
 #include "../interface/Colour.h"
@@ -58,6 +59,9 @@ money32 gTotalIncomeFromAdmissions;
 money32 gParkValue;
 money32 gCompanyValue;
 
+// Number of surface tiles with owned land or construction rights, negative when the map needs to be counted again
+static int32_t _parkSizeTiles = -1;
+
 int16_t gParkRatingCasualtyPenalty;
 uint8_t gParkRatingHistory[32];
 uint8_t gGuestsInParkHistory[32];
@@ -274,14 +278,16 @@ static money32 map_buy_land_rights_for_tile(int32_t x, int32_t y, int32_t settin
             }
             if (flags & GAME_COMMAND_FLAG_APPLY)
             {
-                surfaceElement->properties.surface.ownership |= OWNERSHIP_OWNED;
+                park_set_surface_ownership(surfaceElement, surfaceElement->properties.surface.ownership | OWNERSHIP_OWNED);
                 update_park_fences_around_tile({ x, y });
             }
             return gLandPrice;
         case BUY_LAND_RIGHTS_FLAG_UNOWN_TILE: // 1
             if (flags & GAME_COMMAND_FLAG_APPLY)
             {
-                surfaceElement->properties.surface.ownership &= ~(OWNERSHIP_OWNED | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED);
+                park_set_surface_ownership(
+                    surfaceElement,
+                    surfaceElement->properties.surface.ownership & ~(OWNERSHIP_OWNED | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED));
                 update_park_fences_around_tile({ x, y });
             }
             return 0;
@@ -300,7 +306,8 @@ static money32 map_buy_land_rights_for_tile(int32_t x, int32_t y, int32_t settin
 
             if (flags & GAME_COMMAND_FLAG_APPLY)
             {
-                surfaceElement->properties.surface.ownership |= OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED;
+                park_set_surface_ownership(
+                    surfaceElement, surfaceElement->properties.surface.ownership | OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED);
                 uint16_t baseHeight = surfaceElement->base_height * 8;
                 map_invalidate_tile(x, y, baseHeight, baseHeight + 16);
             }
@@ -308,7 +315,8 @@ static money32 map_buy_land_rights_for_tile(int32_t x, int32_t y, int32_t settin
         case BUY_LAND_RIGHTS_FLAG_UNOWN_CONSTRUCTION_RIGHTS: // 3
             if (flags & GAME_COMMAND_FLAG_APPLY)
             {
-                surfaceElement->properties.surface.ownership &= ~OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED;
+                park_set_surface_ownership(
+                    surfaceElement, surfaceElement->properties.surface.ownership & ~OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED);
                 uint16_t baseHeight = surfaceElement->base_height * 8;
                 map_invalidate_tile(x, y, baseHeight, baseHeight + 16);
             }
@@ -392,8 +400,7 @@ static money32 map_buy_land_rights_for_tile(int32_t x, int32_t y, int32_t settin
                     }
                 }
             }
-            surfaceElement->properties.surface.ownership &= 0x0F;
-            surfaceElement->properties.surface.ownership |= newOwnership;
+            park_set_surface_ownership(surfaceElement, (surfaceElement->properties.surface.ownership & 0x0F) | newOwnership);
             update_park_fences_around_tile({ x, y });
             gMapLandRightsUpdateSuccess = true;
             return 0;
@@ -626,7 +633,7 @@ void Park::Update(const Date& date)
     GenerateGuests();
 }
 
-int32_t Park::CalculateParkSize() const
+static int32_t park_count_owned_tiles()
 {
     int32_t tiles;
     tile_element_iterator it;
@@ -643,6 +650,20 @@ int32_t Park::CalculateParkSize() const
             }
         }
     } while (tile_element_iterator_next(&it));
+    return tiles;
+}
+
+int32_t Park::CalculateParkSize() const
+{
+    // The map is only counted after it has been replaced, ownership changes keep the count up to date otherwise
+    if (_parkSizeTiles < 0)
+    {
+        _parkSizeTiles = park_count_owned_tiles();
+    }
+#if defined(DEBUG_LEVEL_1) && DEBUG_LEVEL_1
+    Guard::Assert(_parkSizeTiles == park_count_owned_tiles(), "Park size is out of sync with the land ownership");
+#endif
+    int32_t tiles = _parkSizeTiles;
 
     if (tiles != gParkSize)
     {
@@ -1102,6 +1123,30 @@ int32_t park_calculate_size()
     return tiles;
 }
 
+/**
+ * Makes the next park size calculation count the owned tiles of the whole map again. Needed when surface elements
+ * are added or removed, or their ownership is set without park_set_surface_ownership().
+ */
+void park_invalidate_size()
+{
+    _parkSizeTiles = -1;
+}
+
+/**
+ * Sets the ownership of a surface element, keeping the park size up to date.
+ */
+void park_set_surface_ownership(rct_tile_element* surfaceElement, uint8_t ownership)
+{
+    constexpr uint8_t countedOwnership = OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED;
+    if (_parkSizeTiles >= 0)
+    {
+        bool wasCounted = (surfaceElement->properties.surface.ownership & countedOwnership) != 0;
+        bool isCounted = (ownership & countedOwnership) != 0;
+        _parkSizeTiles += (int32_t)isCounted - (int32_t)wasCounted;
+    }
+    surfaceElement->properties.surface.ownership = ownership;
+}
+
 uint8_t calculate_guest_initial_happiness(uint8_t percentage)
 {
     return Park::CalculateGuestInitialHappiness(percentage);
@@ -124,6 +124,8 @@ int32_t get_forced_park_rating();
 
 int32_t park_is_open();
 int32_t park_calculate_size();
+void park_invalidate_size();
+void park_set_surface_ownership(rct_tile_element* surfaceElement, uint8_t ownership);
 
 void reset_park_entry();
 
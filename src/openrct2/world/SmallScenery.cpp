@@ -105,7 +105,7 @@ static money32 SmallSceneryRemove(
         }
 
         map_invalidate_tile_full(x, y);
-        tile_element_remove(tileElement);
+        tile_element_remove(x / 32, y / 32, tileElement);
     }
     return (gParkFlags & PARK_FLAGS_NO_MONEY) ? 0 : cost;
 }
@@ -377,7 +377,8 @@ static money32 SmallSceneryPlace(
         network_set_player_last_action_coord(network_get_player_index(game_command_playerid), coord);
     }
 
-    rct_tile_element* newElement = tile_element_insert(x / 32, y / 32, zLow, collisionQuadrants);
+    rct_tile_element* newElement = tile_element_insert(
+        x / 32, y / 32, zLow, collisionQuadrants | ((flags & GAME_COMMAND_FLAG_GHOST) ? TILE_ELEMENT_FLAG_GHOST : 0));
     assert(newElement != nullptr);
     gSceneryTileElement = newElement;
     uint8_t type = quadrant << 6;
@@ -465,7 +466,7 @@ int32_t map_place_scenery_clear_func(rct_tile_element** tile_element, int32_t x,
 
     map_invalidate_tile(x, y, (*tile_element)->base_height * 8, (*tile_element)->clearance_height * 8);
 
-    tile_element_remove(*tile_element);
+    tile_element_remove(x / 32, y / 32, *tile_element);
 
     (*tile_element)--;
     return 0;
@@ -499,7 +500,7 @@ int32_t map_place_non_scenery_clear_func(rct_tile_element** tile_element, int32_
 
     map_invalidate_tile(x, y, (*tile_element)->base_height * 8, (*tile_element)->clearance_height * 8);
 
-    tile_element_remove(*tile_element);
+    tile_element_remove(x / 32, y / 32, *tile_element);
 
     (*tile_element)--;
     return 0;
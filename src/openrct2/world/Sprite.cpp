@@ -13,17 +13,19 @@
 #include "../Game.h"
 #include "../OpenRCT2.h"
 #include "../audio/audio.h"
-#include "../core/Crypt.h"
 #include "../core/Guard.hpp"
 #include "../core/Util.hpp"
 #include "../interface/Viewport.h"
 #include "../localisation/Date.h"
 #include "../localisation/Localisation.h"
 #include "../scenario/Scenario.h"
+#include "../util/Util.h"
 #include "Fountain.h"
 
 #include <algorithm>
+#include <cinttypes>
 #include <cmath>
+#include <cstring>
 
 uint16_t gSpriteListHead[6];
 uint16_t gSpriteListCount[6];
@@ -31,9 +33,18 @@ static rct_sprite _spriteList[MAX_SPRITES];
 
 static bool _spriteFlashingList[MAX_SPRITES];
 
+// One bit per sprite for each sprite list, so that a list can be walked in index order
+static constexpr size_t SPRITE_LIST_INDEX_WORDS = (MAX_SPRITES + 31) / 32;
+static uint32_t _spriteListIndex[NUM_SPRITE_LISTS][SPRITE_LIST_INDEX_WORDS];
+
 #define SPATIAL_INDEX_LOCATION_NULL 0x10000
 
-uint16_t gSpriteSpatialIndex[0x10001];
+// The sprites on each tile sorted by sprite index, the last entry holds the sprites without a location. Keeping each
+// tile sorted makes the order independent of how the sprites got there, so it can be rebuilt from the sprite positions.
+static std::vector<uint16_t> _spriteSpatialGrid[SPATIAL_INDEX_LOCATION_NULL + 1];
+
+// Heads of the next_in_quadrant chains, only up to date after sprite_spatial_index_write_chains
+static uint16_t _spriteSpatialIndex[SPATIAL_INDEX_LOCATION_NULL + 1];
 
 const rct_string_id litterNames[12] = { STR_LITTER_VOMIT,
                                         STR_LITTER_VOMIT,
@@ -52,6 +63,9 @@ static LocationXYZ16 _spritelocations1[MAX_SPRITES];
 static LocationXYZ16 _spritelocations2[MAX_SPRITES];
 
 static size_t GetSpatialIndexOffset(int32_t x, int32_t y);
+static void SpatialGridInsert(size_t index, uint16_t spriteIndex);
+static void SpatialGridRemove(size_t index, uint16_t spriteIndex);
+static void sprite_list_index_set(int32_t list, uint16_t spriteIndex, bool value);
 
 rct_sprite* try_get_sprite(size_t spriteIndex)
 {
@@ -69,10 +83,14 @@ rct_sprite* get_sprite(size_t sprite_idx)
     return &_spriteList[sprite_idx];
 }
 
-uint16_t sprite_get_first_in_quadrant(int32_t x, int32_t y)
+/**
+ * Returns the indices of all sprites on the tile containing the given world coordinates, in ascending order. The span
+ * is invalidated when a sprite on the tile is moved or removed, so copy it first if the caller does either.
+ */
+const std::vector<uint16_t>& sprite_get_tile_sprites(int32_t x, int32_t y)
 {
     int32_t offset = ((x & 0x1FE0) << 3) | (y >> 5);
-    return gSpriteSpatialIndex[offset];
+    return _spriteSpatialGrid[offset];
 }
 
 static void invalidate_sprite_max_zoom(rct_sprite* sprite, int32_t maxZoom)
@@ -163,9 +181,81 @@ void reset_sprite_list()
 
     gSpriteListCount[SPRITE_LIST_NULL] = MAX_SPRITES;
 
+    reset_sprite_list_index();
     reset_sprite_spatial_index();
 }
 
+/**
+ * Rebuilds the per list sprite index from the linked lists, e.g. after they have been loaded from a save.
+ */
+void reset_sprite_list_index()
+{
+    std::memset(_spriteListIndex, 0, sizeof(_spriteListIndex));
+    for (int32_t list = 0; list < NUM_SPRITE_LISTS; list++)
+    {
+        for (uint16_t spriteIndex = gSpriteListHead[list]; spriteIndex != SPRITE_INDEX_NULL;
+             spriteIndex = get_sprite(spriteIndex)->unknown.next)
+        {
+            sprite_list_index_set(list, spriteIndex, true);
+        }
+    }
+}
+
+static void sprite_list_index_set(int32_t list, uint16_t spriteIndex, bool value)
+{
+    uint32_t mask = 1u << (spriteIndex % 32);
+    if (value)
+    {
+        _spriteListIndex[list][spriteIndex / 32] |= mask;
+    }
+    else
+    {
+        _spriteListIndex[list][spriteIndex / 32] &= ~mask;
+    }
+}
+
+/**
+ * Returns the sprite with the lowest index in the given list, or SPRITE_INDEX_NULL if the list is empty.
+ */
+uint16_t sprite_list_get_first(uint8_t list)
+{
+    for (size_t word = 0; word < SPRITE_LIST_INDEX_WORDS; word++)
+    {
+        uint32_t bits = _spriteListIndex[list][word];
+        if (bits != 0)
+        {
+            return (uint16_t)(word * 32 + bitscanforward(bits));
+        }
+    }
+    return SPRITE_INDEX_NULL;
+}
+
+/**
+ * Returns the sprite with the lowest index above spriteIndex in the given list, or SPRITE_INDEX_NULL if there is none.
+ */
+uint16_t sprite_list_get_next(uint8_t list, uint16_t spriteIndex)
+{
+    size_t next = (size_t)spriteIndex + 1;
+    size_t word = next / 32;
+    if (word >= SPRITE_LIST_INDEX_WORDS)
+    {
+        return SPRITE_INDEX_NULL;
+    }
+
+    // Mask off the sprites up to and including the current one
+    uint32_t bits = _spriteListIndex[list][word] & (0xFFFFFFFFu << (next % 32));
+    while (bits == 0)
+    {
+        word++;
+        if (word >= SPRITE_LIST_INDEX_WORDS)
+        {
+            return SPRITE_INDEX_NULL;
+        }
+        bits = _spriteListIndex[list][word];
+    }
+    return (uint16_t)(word * 32 + bitscanforward(bits));
+}
+
 /**
  *
  *  rct2: 0x0069EBE4
@@ -174,17 +264,54 @@ void reset_sprite_list()
  */
 void reset_sprite_spatial_index()
 {
-    std::fill_n(gSpriteSpatialIndex, Util::CountOf(gSpriteSpatialIndex), SPRITE_INDEX_NULL);
+    for (auto& tile : _spriteSpatialGrid)
+    {
+        tile.clear();
+    }
     for (size_t i = 0; i < MAX_SPRITES; i++)
     {
         rct_sprite* spr = get_sprite(i);
         if (spr->unknown.sprite_identifier != SPRITE_IDENTIFIER_NULL)
         {
             size_t index = GetSpatialIndexOffset(spr->unknown.x, spr->unknown.y);
-            uint16_t nextSpriteId = gSpriteSpatialIndex[index];
-            gSpriteSpatialIndex[index] = spr->unknown.sprite_index;
-            spr->unknown.next_in_quadrant = nextSpriteId;
+            _spriteSpatialGrid[index].push_back(spr->unknown.sprite_index);
+        }
+    }
+    sprite_spatial_index_write_chains();
+}
+
+/**
+ * Writes the spatial grid into the next_in_quadrant chains of the sprites, which is how the spatial index is stored
+ * in saves. The chains are not kept up to date while the game is running.
+ */
+void sprite_spatial_index_write_chains()
+{
+    for (size_t i = 0; i < Util::CountOf(_spriteSpatialGrid); i++)
+    {
+        const auto& tile = _spriteSpatialGrid[i];
+        uint16_t nextSpriteIndex = SPRITE_INDEX_NULL;
+        for (auto it = tile.rbegin(); it != tile.rend(); it++)
+        {
+            get_sprite(*it)->unknown.next_in_quadrant = nextSpriteIndex;
+            nextSpriteIndex = *it;
         }
+        _spriteSpatialIndex[i] = nextSpriteIndex;
+    }
+}
+
+static void SpatialGridInsert(size_t index, uint16_t spriteIndex)
+{
+    auto& tile = _spriteSpatialGrid[index];
+    tile.insert(std::lower_bound(tile.begin(), tile.end(), spriteIndex), spriteIndex);
+}
+
+static void SpatialGridRemove(size_t index, uint16_t spriteIndex)
+{
+    auto& tile = _spriteSpatialGrid[index];
+    auto it = std::lower_bound(tile.begin(), tile.end(), spriteIndex);
+    if (it != tile.end() && *it == spriteIndex)
+    {
+        tile.erase(it);
     }
 }
 
@@ -201,77 +328,83 @@ static size_t GetSpatialIndexOffset(int32_t x, int32_t y)
         index = (flooredX << 3) | tileY;
     }
 
-    openrct2_assert(index < sizeof(gSpriteSpatialIndex), "GetSpatialIndexOffset out of range");
+    openrct2_assert(index < Util::CountOf(_spriteSpatialGrid), "GetSpatialIndexOffset out of range");
     return index;
 }
 
-#ifndef DISABLE_NETWORK
+/**
+ * Hashes a single sprite slot. The slot index is part of the seed so that two sprites trading places changes the
+ * resulting checksum.
+ */
+static uint64_t sprite_checksum_slot(const rct_sprite* sprite, uint16_t spriteIndex)
+{
+    auto copy = *sprite;
+    copy.unknown.sprite_left = copy.unknown.sprite_right = copy.unknown.sprite_top = copy.unknown.sprite_bottom = 0;
+
+    // The quadrant chains are only written out when saving
+    copy.unknown.next_in_quadrant = 0;
+
+    if (copy.unknown.sprite_identifier == SPRITE_IDENTIFIER_PEEP)
+    {
+        // We set this to 0 because as soon the client selects a guest the window will remove the
+        // invalidation flags causing the sprite checksum to be different than on server, the flag does not affect
+        // game state.
+        copy.peep.window_invalidate_flags = 0;
+    }
+
+    // FNV-1a over 64-bit words
+    static_assert(sizeof(rct_sprite) % sizeof(uint64_t) == 0, "Sprite size must be a multiple of 8 bytes");
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(&copy);
+    uint64_t hash = 0xCBF29CE484222325ULL ^ spriteIndex;
+    for (size_t i = 0; i < sizeof(rct_sprite); i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * 0x100000001B3ULL;
+    }
+
+    // Finalise so that every input bit affects the low bits before the slot hashes are summed
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
 
+/**
+ * Computes a checksum of all the sprites that affect the game state. The per sprite hashes are summed, so only the
+ * sprite lists that are in use are walked and the order in which they are visited does not matter.
+ */
 const char* sprite_checksum()
 {
-    using namespace Crypt;
-
     // TODO Remove statics, should be one of these per sprite manager / OpenRCT2 context.
-    //      Alternatively, make a new class for this functionality.
-    static std::unique_ptr<HashAlgorithm<20>> _spriteHashAlg;
-    static std::string result;
+    static char result[17];
 
-    try
+    uint64_t checksum = 0;
+    for (int32_t list = SPRITE_LIST_TRAIN; list < NUM_SPRITE_LISTS; list++)
     {
-        if (_spriteHashAlg == nullptr)
+        if (list == SPRITE_LIST_MISC)
         {
-            _spriteHashAlg = CreateSHA1();
+            continue;
         }
 
-        _spriteHashAlg->Clear();
-        for (size_t i = 0; i < MAX_SPRITES; i++)
+        for (uint16_t spriteIndex = gSpriteListHead[list]; spriteIndex != SPRITE_INDEX_NULL;)
         {
-            auto sprite = get_sprite(i);
+            auto sprite = get_sprite(spriteIndex);
             if (sprite->unknown.sprite_identifier != SPRITE_IDENTIFIER_NULL
                 && sprite->unknown.sprite_identifier != SPRITE_IDENTIFIER_MISC)
             {
-                auto copy = *sprite;
-                copy.unknown.sprite_left = copy.unknown.sprite_right = copy.unknown.sprite_top = copy.unknown.sprite_bottom = 0;
-
-                if (copy.unknown.sprite_identifier == SPRITE_IDENTIFIER_PEEP)
-                {
-                    // We set this to 0 because as soon the client selects a guest the window will remove the
-                    // invalidation flags causing the sprite checksum to be different than on server, the flag does not affect
-                    // game state.
-                    copy.peep.window_invalidate_flags = 0;
-                }
-
-                _spriteHashAlg->Update(&copy, sizeof(copy));
+                checksum += sprite_checksum_slot(sprite, spriteIndex);
             }
+            spriteIndex = sprite->unknown.next;
         }
-
-        auto hash = _spriteHashAlg->Finish();
-
-        result.clear();
-        result.reserve(hash.size() * 2);
-        for (auto b : hash)
-        {
-            char buf[3];
-            snprintf(buf, 3, "%02x", b);
-            result.append(buf);
-        }
-        return result.c_str();
     }
-    catch (std::exception& e)
-    {
-        log_error("sprite_checksum failed: %s", e.what());
-        throw;
-    }
-}
-#else
 
-const char* sprite_checksum()
-{
-    return nullptr;
+    snprintf(result, sizeof(result), "%016" PRIx64, checksum);
+    return result;
 }
 
-#endif // DISABLE_NETWORK
-
 static void sprite_reset(rct_unk_sprite* sprite)
 {
     // Need to retain how the sprite is linked in lists
@@ -365,8 +498,7 @@ rct_sprite* create_sprite(uint8_t bl)
     sprite->flags = 0;
     sprite->sprite_left = LOCATION_NULL;
 
-    sprite->next_in_quadrant = gSpriteSpatialIndex[SPATIAL_INDEX_LOCATION_NULL];
-    gSpriteSpatialIndex[SPATIAL_INDEX_LOCATION_NULL] = sprite->sprite_index;
+    SpatialGridInsert(SPATIAL_INDEX_LOCATION_NULL, sprite->sprite_index);
 
     return (rct_sprite*)sprite;
 }
@@ -425,6 +557,9 @@ void move_sprite_to_list(rct_sprite* sprite, uint8_t newListOffset)
     // Decrement old list counter, increment new list counter.
     gSpriteListCount[oldList]--;
     gSpriteListCount[newList]++;
+
+    sprite_list_index_set(oldList, unkSprite->sprite_index, false);
+    sprite_list_index_set(newList, unkSprite->sprite_index, true);
 }
 
 /**
@@ -560,14 +695,8 @@ static void sprite_misc_update(rct_sprite* sprite)
  */
 void sprite_misc_update_all()
 {
-    rct_sprite* sprite;
-    uint16_t spriteIndex;
-
-    spriteIndex = gSpriteListHead[SPRITE_LIST_MISC];
-    while (spriteIndex != SPRITE_INDEX_NULL)
+    for (auto sprite : SpriteListRange(SPRITE_LIST_MISC))
     {
-        sprite = get_sprite(spriteIndex);
-        spriteIndex = sprite->unknown.next;
         sprite_misc_update(sprite);
     }
 }
@@ -592,25 +721,8 @@ void sprite_move(int16_t x, int16_t y, int16_t z, rct_sprite* sprite)
     size_t currentIndex = GetSpatialIndexOffset(sprite->unknown.x, sprite->unknown.y);
     if (newIndex != currentIndex)
     {
-        uint16_t* spriteIndex = &gSpriteSpatialIndex[currentIndex];
-        if (*spriteIndex != SPRITE_INDEX_NULL)
-        {
-            rct_sprite* sprite2 = get_sprite(*spriteIndex);
-            while (sprite != sprite2)
-            {
-                spriteIndex = &sprite2->unknown.next_in_quadrant;
-                if (*spriteIndex == SPRITE_INDEX_NULL)
-                {
-                    break;
-                }
-                sprite2 = get_sprite(*spriteIndex);
-            }
-        }
-        *spriteIndex = sprite->unknown.next_in_quadrant;
-
-        int32_t tempSpriteIndex = gSpriteSpatialIndex[newIndex];
-        gSpriteSpatialIndex[newIndex] = sprite->unknown.sprite_index;
-        sprite->unknown.next_in_quadrant = tempSpriteIndex;
+        SpatialGridRemove(currentIndex, sprite->unknown.sprite_index);
+        SpatialGridInsert(newIndex, sprite->unknown.sprite_index);
     }
 
     if (x == LOCATION_NULL)
@@ -670,13 +782,7 @@ void sprite_remove(rct_sprite* sprite)
     _spriteFlashingList[sprite->unknown.sprite_index] = false;
 
     size_t quadrantIndex = GetSpatialIndexOffset(sprite->unknown.x, sprite->unknown.y);
-    uint16_t* spriteIndex = &gSpriteSpatialIndex[quadrantIndex];
-    rct_sprite* quadrantSprite;
-    while (*spriteIndex != SPRITE_INDEX_NULL && (quadrantSprite = get_sprite(*spriteIndex)) != sprite)
-    {
-        spriteIndex = &quadrantSprite->unknown.next_in_quadrant;
-    }
-    *spriteIndex = sprite->unknown.next_in_quadrant;
+    SpatialGridRemove(quadrantIndex, sprite->unknown.sprite_index);
 }
 
 static bool litter_can_be_at(int32_t x, int32_t y, int32_t z)
@@ -764,11 +870,11 @@ void litter_create(int32_t x, int32_t y, int32_t z, int32_t direction, int32_t t
  */
 void litter_remove_at(int32_t x, int32_t y, int32_t z)
 {
-    uint16_t spriteIndex = sprite_get_first_in_quadrant(x, y);
-    while (spriteIndex != SPRITE_INDEX_NULL)
+    // Copy the sprites as removing litter modifies the tile
+    std::vector<uint16_t> spriteIndices = sprite_get_tile_sprites(x, y);
+    for (uint16_t spriteIndex : spriteIndices)
     {
         rct_sprite* sprite = get_sprite(spriteIndex);
-        uint16_t nextSpriteIndex = sprite->unknown.next_in_quadrant;
         if (sprite->unknown.linked_list_type_offset == SPRITE_LIST_LITTER * 2)
         {
             rct_litter* litter = &sprite->litter;
@@ -782,7 +888,6 @@ void litter_remove_at(int32_t x, int32_t y, int32_t z)
                 }
             }
         }
-        spriteIndex = nextSpriteIndex;
     }
 }
 
@@ -1060,7 +1165,7 @@ int32_t check_for_spatial_index_cycles(bool fix)
 {
     for (int32_t i = 0; i < SPATIAL_INDEX_LOCATION_NULL; i++)
     {
-        rct_sprite* cycle_start = find_sprite_quadrant_cycle(gSpriteSpatialIndex[i]);
+        rct_sprite* cycle_start = find_sprite_quadrant_cycle(_spriteSpatialIndex[i]);
         if (cycle_start != nullptr)
         {
             if (fix)
@@ -14,6 +14,8 @@
 #include "../peep/Peep.h"
 #include "../ride/Vehicle.h"
 
+#include <vector>
+
 #define SPRITE_INDEX_NULL 0xFFFF
 #define MAX_SPRITES 10000
 #define NUM_SPRITE_LISTS 6
@@ -391,13 +393,16 @@ rct_sprite* get_sprite(size_t sprite_idx);
 
 extern uint16_t gSpriteListHead[6];
 extern uint16_t gSpriteListCount[6];
-extern uint16_t gSpriteSpatialIndex[0x10001];
 
 extern const rct_string_id litterNames[12];
 
 rct_sprite* create_sprite(uint8_t bl);
 void reset_sprite_list();
+void reset_sprite_list_index();
 void reset_sprite_spatial_index();
+void sprite_spatial_index_write_chains();
+uint16_t sprite_list_get_first(uint8_t list);
+uint16_t sprite_list_get_next(uint8_t list, uint16_t spriteIndex);
 void sprite_clear_all_unused();
 void move_sprite_to_list(rct_sprite* sprite, uint8_t cl);
 void sprite_misc_update_all();
@@ -411,13 +416,64 @@ void litter_create(int32_t x, int32_t y, int32_t z, int32_t direction, int32_t t
 void litter_remove_at(int32_t x, int32_t y, int32_t z);
 void sprite_misc_explosion_cloud_create(int32_t x, int32_t y, int32_t z);
 void sprite_misc_explosion_flare_create(int32_t x, int32_t y, int32_t z);
-uint16_t sprite_get_first_in_quadrant(int32_t x, int32_t y);
+const std::vector<uint16_t>& sprite_get_tile_sprites(int32_t x, int32_t y);
 void sprite_position_tween_store_a();
 void sprite_position_tween_store_b();
 void sprite_position_tween_all(float nudge);
 void sprite_position_tween_restore();
 void sprite_position_tween_reset();
 
+/**
+ * Iterates over the sprites of a sprite list in ascending index order, which walks the sprite array front to back
+ * rather than jumping around it like the linked list does. The sprite being visited may be removed from the list.
+ */
+class SpriteListRange
+{
+private:
+    uint8_t _list;
+
+public:
+    class Iterator
+    {
+    private:
+        uint8_t _list;
+        uint16_t _spriteIndex;
+
+    public:
+        Iterator(uint8_t list, uint16_t spriteIndex)
+            : _list(list)
+            , _spriteIndex(spriteIndex)
+        {
+        }
+        rct_sprite* operator*() const
+        {
+            return get_sprite(_spriteIndex);
+        }
+        Iterator& operator++()
+        {
+            _spriteIndex = sprite_list_get_next(_list, _spriteIndex);
+            return *this;
+        }
+        bool operator!=(const Iterator& other) const
+        {
+            return _spriteIndex != other._spriteIndex;
+        }
+    };
+
+    explicit SpriteListRange(uint8_t list)
+        : _list(list)
+    {
+    }
+    Iterator begin() const
+    {
+        return Iterator(_list, sprite_list_get_first(_list));
+    }
+    Iterator end() const
+    {
+        return Iterator(_list, SPRITE_INDEX_NULL);
+    }
+};
+
 ///////////////////////////////////////////////////////////////
 // Balloon
 ///////////////////////////////////////////////////////////////
@@ -154,7 +154,7 @@ int32_t tile_inspector_remove_element_at(int32_t x, int32_t y, int16_t elementIn
         {
             return MONEY32_UNDEFINED;
         }
-        tile_element_remove(tileElement);
+        tile_element_remove(x, y, tileElement);
         map_invalidate_tile_full(x << 5, y << 5);
 
         // Update the window
@@ -343,6 +343,10 @@ int32_t tile_inspector_paste_element_at(int32_t x, int32_t y, rct_tile_element e
             pastedElement->flags |= TILE_ELEMENT_FLAG_LAST_TILE;
         }
 
+        if (pastedElement->GetType() == TILE_ELEMENT_TYPE_SURFACE)
+        {
+            park_invalidate_size();
+        }
         map_invalidate_tile_full(x << 5, y << 5);
 
         rct_window* const tileInspectorWindow = window_find_by_class(WC_TILE_INSPECTOR);
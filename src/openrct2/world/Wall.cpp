@@ -507,7 +507,8 @@ static money32 WallPlace(
             network_set_player_last_action_coord(network_get_player_index(game_command_playerid), coord);
         }
 
-        rct_tile_element* tileElement = tile_element_insert(position.x / 32, position.y / 32, position.z / 8, 0);
+        rct_tile_element* tileElement = tile_element_insert(
+            position.x / 32, position.y / 32, position.z / 8, (flags & GAME_COMMAND_FLAG_GHOST) ? TILE_ELEMENT_FLAG_GHOST : 0);
         assert(tileElement != nullptr);
 
         map_animation_create(MAP_ANIMATION_TYPE_WALL, position.x, position.y, position.z / 8);
@@ -670,7 +671,7 @@ repeat:
 
         tile_element_remove_banner_entry(tileElement);
         map_invalidate_tile_zoom1(x, y, tileElement->base_height * 8, tileElement->base_height * 8 + 72);
-        tile_element_remove(tileElement);
+        tile_element_remove(x / 32, y / 32, tileElement);
         goto repeat;
     } while (!(tileElement++)->IsLastForTile());
 }
@@ -706,7 +707,7 @@ void wall_remove_intersecting_walls(int32_t x, int32_t y, int32_t z0, int32_t z1
 
         tile_element_remove_banner_entry(tileElement);
         map_invalidate_tile_zoom1(x, y, tileElement->base_height * 8, tileElement->base_height * 8 + 72);
-        tile_element_remove(tileElement);
+        tile_element_remove(x / 32, y / 32, tileElement);
         tileElement--;
     } while (!(tileElement++)->IsLastForTile());
 }
@@ -0,0 +1,114 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/util/Util.h>
+#include <random>
+#include <vector>
+
+using CopyNonZeroFn = void (*)(const uint8_t*, uint8_t*, int32_t);
+using CopyZoomedFn = void (*)(const uint8_t*, uint8_t*, int32_t, int32_t);
+using FillPatternFn = void (*)(uint8_t*, int32_t, uint8_t, uint16_t);
+
+struct DrawingKernels
+{
+    const char* Name;
+    CopyNonZeroFn CopyNonZero;
+    CopyZoomedFn CopyZoomed;
+    FillPatternFn FillPattern;
+};
+
+class DrawingKernelTests : public testing::Test
+{
+protected:
+    std::mt19937 _random{ 1234 };
+
+    // Every vectorised variant the CPU running the tests supports, each one is checked against the scalar reference
+    static std::vector<DrawingKernels> GetSimdKernels()
+    {
+        std::vector<DrawingKernels> kernels;
+        if (sse41_available())
+        {
+            kernels.push_back({ "SSE4.1", blit_copy_nonzero_sse4_1, blit_copy_zoomed_sse4_1, blit_fill_pattern_sse4_1 });
+        }
+        if (avx2_available())
+        {
+            kernels.push_back({ "AVX2", blit_copy_nonzero_avx2, blit_copy_zoomed_avx2, blit_fill_pattern_avx2 });
+        }
+        return kernels;
+    }
+
+    std::vector<uint8_t> GetRandomPixels(size_t count)
+    {
+        // Make about a third of the pixels transparent
+        std::vector<uint8_t> pixels(count);
+        for (auto& pixel : pixels)
+        {
+            uint32_t value = _random() % 384;
+            pixel = value >= 256 ? 0 : (uint8_t)value;
+        }
+        return pixels;
+    }
+};
+
+TEST_F(DrawingKernelTests, CopyNonZero_MatchesScalar)
+{
+    for (const auto& kernels : GetSimdKernels())
+    {
+        for (int32_t count = 0; count <= 200; count++)
+        {
+            auto src = GetRandomPixels(count);
+            auto expected = GetRandomPixels(count);
+            auto actual = expected;
+            blit_copy_nonzero_scalar(src.data(), expected.data(), count);
+            kernels.CopyNonZero(src.data(), actual.data(), count);
+            ASSERT_EQ(expected, actual) << kernels.Name << ", count " << count;
+        }
+    }
+}
+
+TEST_F(DrawingKernelTests, CopyZoomed_MatchesScalar)
+{
+    for (const auto& kernels : GetSimdKernels())
+    {
+        for (int32_t zoomLevel = 0; zoomLevel <= 3; zoomLevel++)
+        {
+            for (int32_t count = 0; count <= 200; count++)
+            {
+                // Size the source exactly so that reading past the last sampled pixel is caught by sanitizers
+                size_t srcCount = count == 0 ? 0 : ((count - 1) << zoomLevel) + 1;
+                auto src = GetRandomPixels(srcCount);
+                auto expected = GetRandomPixels(count);
+                auto actual = expected;
+                blit_copy_zoomed_scalar(src.data(), expected.data(), count, zoomLevel);
+                kernels.CopyZoomed(src.data(), actual.data(), count, zoomLevel);
+                ASSERT_EQ(expected, actual) << kernels.Name << ", zoom " << zoomLevel << ", count " << count;
+            }
+        }
+    }
+}
+
+TEST_F(DrawingKernelTests, FillPattern_MatchesScalar)
+{
+    for (const auto& kernels : GetSimdKernels())
+    {
+        for (uint16_t pattern : { 0x0000, 0x5555, 0xAAAA, 0x8001, 0xFFFF, 0x1234 })
+        {
+            for (int32_t count = 0; count <= 100; count++)
+            {
+                auto expected = GetRandomPixels(count);
+                auto actual = expected;
+                blit_fill_pattern_scalar(expected.data(), count, 42, pattern);
+                kernels.FillPattern(actual.data(), count, 42, pattern);
+                ASSERT_EQ(expected, actual) << kernels.Name << ", pattern " << pattern << ", count " << count;
+            }
+        }
+    }
+}
@@ -0,0 +1,139 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2018 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/drawing/SpriteCache.h>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2::Drawing;
+
+class SpriteCacheTests : public testing::Test
+{
+protected:
+    static constexpr int32_t SPRITE_WIDTH = 61;
+    static constexpr int32_t SPRITE_HEIGHT = 37;
+
+    std::mt19937 _random{ 1234 };
+    std::vector<uint8_t> _spriteData;
+    rct_g1_element _g1 = {};
+
+    void SetUp() override
+    {
+        // Build an RLE sprite with a random set of runs on each line, leaving some lines empty
+        _spriteData.resize(SPRITE_HEIGHT * sizeof(uint16_t));
+        for (int32_t y = 0; y < SPRITE_HEIGHT; y++)
+        {
+            uint16_t lineOffset = (uint16_t)_spriteData.size();
+            std::memcpy(&_spriteData[y * sizeof(uint16_t)], &lineOffset, sizeof(uint16_t));
+
+            size_t lastRun = _spriteData.size();
+            int32_t x = _random() % 8;
+            while (x < SPRITE_WIDTH && _random() % 5 != 0)
+            {
+                int32_t length = std::min<int32_t>(1 + _random() % 12, SPRITE_WIDTH - x);
+                lastRun = _spriteData.size();
+                _spriteData.push_back((uint8_t)length);
+                _spriteData.push_back((uint8_t)x);
+                for (int32_t i = 0; i < length; i++)
+                {
+                    _spriteData.push_back((uint8_t)(1 + _random() % 255));
+                }
+                x += length + _random() % 6;
+            }
+            if (lastRun == _spriteData.size())
+            {
+                _spriteData.push_back(0);
+                _spriteData.push_back(0);
+            }
+            _spriteData[lastRun] |= 0x80;
+        }
+
+        _g1.offset = _spriteData.data();
+        _g1.width = SPRITE_WIDTH;
+        _g1.height = SPRITE_HEIGHT;
+        _g1.flags = G1_FLAG_RLE_COMPRESSION;
+    }
+};
+
+TEST_F(SpriteCacheTests, Prescaled_MatchesZoomedDraw)
+{
+    constexpr int32_t destWidth = 40;
+    constexpr int32_t destHeight = 24;
+
+    for (int32_t zoomLevel = 1; zoomLevel <= 3; zoomLevel++)
+    {
+        int32_t zoomAmount = 1 << zoomLevel;
+        for (int32_t i = 0; i < 500; i++)
+        {
+            // Clipping on the left can leave the source start slightly negative when the view is not zoom aligned
+            int32_t sourceX = (int32_t)(_random() % (SPRITE_WIDTH + zoomAmount - 1)) - zoomAmount + 1;
+            int32_t sourceY = _random() % SPRITE_HEIGHT;
+            int32_t width = 1 + _random() % (SPRITE_WIDTH - std::max(0, sourceX));
+            int32_t height = 1 + _random() % (SPRITE_HEIGHT - sourceY);
+
+            rct_drawpixelinfo dpi = {};
+            dpi.width = destWidth << zoomLevel;
+            dpi.height = destHeight << zoomLevel;
+            dpi.zoom_level = zoomLevel;
+
+            std::vector<uint8_t> expected(destWidth * destHeight, 0);
+            dpi.bits = expected.data();
+            gfx_rle_sprite_to_buffer(
+                _spriteData.data(), expected.data(), nullptr, &dpi, IMAGE_TYPE_DEFAULT, sourceY, height, sourceX, width);
+
+            int32_t phaseX = sourceX & (zoomAmount - 1);
+            int32_t phaseY = sourceY & (zoomAmount - 1);
+            auto sprite = PrescaleRLESprite(&_g1, zoomLevel, phaseX, phaseY);
+
+            std::vector<uint8_t> actual(destWidth * destHeight, 0);
+            rct_drawpixelinfo prescaledDpi = dpi;
+            prescaledDpi.bits = actual.data();
+            prescaledDpi.width = destWidth;
+            prescaledDpi.zoom_level = 0;
+            gfx_rle_sprite_to_buffer(
+                sprite->Data.data(), actual.data(), nullptr, &prescaledDpi, IMAGE_TYPE_DEFAULT, sourceY >> zoomLevel,
+                (height + zoomAmount - 1) >> zoomLevel, sourceX >> zoomLevel, (width + zoomAmount - 1) >> zoomLevel);
+
+            ASSERT_EQ(expected, actual) << "zoom " << zoomLevel << ", source " << sourceX << "," << sourceY << ", size "
+                                        << width << "x" << height;
+        }
+    }
+}
+
+TEST_F(SpriteCacheTests, GetPrescaled_DisabledWithoutBudget)
+{
+    SpriteCache cache;
+    ASSERT_EQ(cache.GetPrescaled(1, &_g1, 1, 0, 0), nullptr);
+}
+
+TEST_F(SpriteCacheTests, GetPrescaled_ReusesUntilInvalidated)
+{
+    SpriteCache cache(1024 * 1024);
+    auto first = cache.GetPrescaled(1, &_g1, 1, 0, 0);
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(cache.GetPrescaled(1, &_g1, 1, 0, 0), first);
+    ASSERT_NE(cache.GetPrescaled(1, &_g1, 1, 1, 0), first);
+
+    cache.Invalidate(1);
+    ASSERT_NE(cache.GetPrescaled(1, &_g1, 1, 0, 0), first);
+}
+
+TEST_F(SpriteCacheTests, GetPrescaled_EvictsOverBudget)
+{
+    // Room for a single sprite in each shard, images 1 and 17 share a shard
+    auto spriteSize = PrescaleRLESprite(&_g1, 1, 0, 0)->Data.size();
+    SpriteCache cache((spriteSize + 256) * 16);
+    auto first = cache.GetPrescaled(1, &_g1, 1, 0, 0);
+    cache.GetPrescaled(17, &_g1, 1, 0, 0);
+    ASSERT_NE(cache.GetPrescaled(1, &_g1, 1, 0, 0), first);
+}
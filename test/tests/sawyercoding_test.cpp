@@ -9,7 +9,9 @@
 
 #include <gtest/gtest.h>
 #include <openrct2/core/MemoryStream.h>
+#include <openrct2/rct12/SawyerChecksumStream.h>
 #include <openrct2/rct12/SawyerChunkReader.h>
+#include <openrct2/rct12/SawyerEncoding.h>
 #include <openrct2/util/SawyerCoding.h>
 
 constexpr size_t BUFFER_SIZE = 0x600000;
@@ -106,6 +108,62 @@ TEST_F(SawyerCodingTest, decode_chunk_rotate)
     test_decode(rotatedata, sizeof(rotatedata));
 }
 
+TEST_F(SawyerCodingTest, checksum_stream_write)
+{
+    MemoryStream ms;
+    SawyerChecksumStream checksumStream(&ms);
+    checksumStream.Write(randomdata, 100);
+    checksumStream.Write(randomdata + 100, sizeof(randomdata) - 100);
+    ASSERT_TRUE(checksumStream.IsChecksumComplete());
+    ASSERT_EQ(checksumStream.GetChecksum(), sawyercoding_calculate_checksum(randomdata, sizeof(randomdata)));
+
+    // Overwriting data that has already been summed can not be accounted for
+    checksumStream.SetPosition(0);
+    checksumStream.Write(randomdata, 1);
+    ASSERT_FALSE(checksumStream.IsChecksumComplete());
+}
+
+TEST_F(SawyerCodingTest, checksum_stream_read)
+{
+    MemoryStream ms(randomdata, sizeof(randomdata));
+    SawyerChecksumStream checksumStream(&ms);
+    uint8_t buffer[sizeof(randomdata)];
+    checksumStream.Read(buffer, 600);
+
+    // Data read again after seeking back is only summed once
+    checksumStream.SetPosition(200);
+    checksumStream.Read(buffer, sizeof(randomdata) - 200);
+    ASSERT_TRUE(checksumStream.IsChecksumComplete());
+    ASSERT_EQ(checksumStream.GetChecksum(), sawyercoding_calculate_checksum(randomdata, sizeof(randomdata)));
+
+    // Skipping data leaves the checksum incomplete
+    MemoryStream ms2(randomdata, sizeof(randomdata));
+    SawyerChecksumStream skippingStream(&ms2);
+    skippingStream.Seek(10, STREAM_SEEK_CURRENT);
+    skippingStream.Read(buffer, 10);
+    ASSERT_FALSE(skippingStream.IsChecksumComplete());
+}
+
+TEST_F(SawyerCodingTest, checksum_stream_validate)
+{
+    MemoryStream ms;
+    ms.Write(randomdata, sizeof(randomdata));
+    ms.WriteValue(sawyercoding_calculate_checksum(randomdata, sizeof(randomdata)));
+    ms.SetPosition(0);
+
+    SawyerChecksumStream checksumStream(&ms);
+    uint8_t buffer[100];
+    checksumStream.Read(buffer, sizeof(buffer));
+    ASSERT_TRUE(SawyerEncoding::ValidateStreamedChecksum(&checksumStream));
+
+    // Corrupt the first byte
+    ms.SetPosition(0);
+    ms.WriteValue<uint8_t>(randomdata[0] + 1);
+    ms.SetPosition(0);
+    SawyerChecksumStream corruptStream(&ms);
+    ASSERT_FALSE(SawyerEncoding::ValidateStreamedChecksum(&corruptStream));
+}
+
 // 1024 bytes of random data
 // use `dd if=/dev/urandom bs=1024 count=1 | xxd -i` to get your own
 const uint8_t SawyerCodingTest::randomdata[] = {